@@ -0,0 +1,122 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2012 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/// A USE_DISPATCH build links, next to the generic engine, one more copy of
+/// the whole engine for each instruction set it dispatches to. Each copy is
+/// built by compiling this file once per source file of the engine with
+///
+///   -DUSE_DISPATCH -DARCH_SOURCE='"search.cpp"' -DARCH_POPCNT
+///   -DUSE_DISPATCH -DARCH_SOURCE='"search.cpp"' -DARCH_BMI2
+///
+/// The source is compiled as in a USE_POPCNT (or USE_POPCNT plus USE_PEXT)
+/// build, inside namespace Popcnt (or Bmi2), so that the copies don't clash
+/// at link time. main() of the generic engine checks the CPU and then calls
+/// Popcnt::main() or Bmi2::main(), so the copy runs from the first command
+/// on with its own tables and with popcount() and attacks_bb() inlined as in
+/// a per-arch binary. Without ARCH_SOURCE this file is empty.
+
+#if defined(ARCH_SOURCE)
+
+#if !defined(USE_DISPATCH) || defined(USE_POPCNT) || defined(USE_PEXT)
+#  error "ARCH_SOURCE is only for USE_DISPATCH builds"
+#endif
+
+// The system headers must be included out of the namespace and before the
+// target pragma, so that everything but the engine itself stays shared and
+// generic. The list must cover all the headers the engine includes.
+#include <algorithm>
+#include <cassert>
+#include <cctype>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <iosfwd>
+#include <iostream>
+#include <istream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stack>
+#include <string>
+#include <vector>
+
+#include "platform.h"
+
+#if defined(_WIN32) || defined(_WIN64)
+#  include <fcntl.h>
+#  include <io.h>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+#if defined(__linux__)
+#  include <dirent.h>
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#endif
+
+#if defined(_MSC_VER)
+#  include <intrin.h>
+#  include <immintrin.h>
+#  if defined(__INTEL_COMPILER)
+#    include <nmmintrin.h>
+#  endif
+#elif defined(__GNUC__)
+#  include <cpuid.h>
+#  include <immintrin.h>
+#  include <xmmintrin.h>
+#endif
+
+#define USE_POPCNT
+
+#if defined(ARCH_BMI2)
+#  define USE_PEXT
+#  define ARCH_NAMESPACE Bmi2
+#  define start_routine bmi2_start_routine
+#  if defined(__GNUC__)
+#    pragma GCC target("popcnt,bmi,bmi2")
+#  endif
+#elif defined(ARCH_POPCNT)
+#  define ARCH_NAMESPACE Popcnt
+#  define start_routine popcnt_start_routine
+#  if defined(__GNUC__)
+#    pragma GCC target("popcnt")
+#  endif
+#else
+#  error "ARCH_SOURCE requires ARCH_POPCNT or ARCH_BMI2"
+#endif
+
+// The namespace does not apply to names with C linkage, so the extern "C"
+// thread start function of thread.cpp is renamed above for each copy.
+
+namespace ARCH_NAMESPACE {
+#include ARCH_SOURCE
+}
+
+#endif // defined(ARCH_SOURCE)
@@ -0,0 +1,340 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2012 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <climits>
+#include <deque>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32) || defined(_WIN64)
+#  include <fcntl.h>
+#  include <io.h>
+#endif
+
+#include "position.h"
+#include "search.h"
+#include "thread.h"
+#include "ucioption.h"
+
+using namespace std;
+
+namespace {
+
+  // The batch protocol reads fixed size requests from stdin and writes, in the
+  // same order, a fixed size response to stdout for each one. All the numbers
+  // are little-endian.
+  //
+  // Request, 48 bytes:
+  //   0  Board, 64 nibbles: a1 in the low nibble of byte 0, b1 in the high one,
+  //      and so on up to h8. Pieces are coded as in the Piece enum: 1 to 6 for
+  //      the white pawn to king, 9 to 14 for the black ones, 0 for none.
+  //  32  Side to move, 0 for white and 1 for black
+  //  33  Castling rights, as in the CastleRight enum
+  //  34  En passant square, 0 (a1) to 63 (h8), or 64 for none
+  //  35  Rule 50 counter
+  //  36  uint16 depth limit, 0 for none
+  //  38  uint16 reserved
+  //  40  uint32 movetime limit in milliseconds, 0 for none
+  //  44  uint32 nodes limit, 0 for none. At least one limit must be given.
+  //
+  // Response, 16 bytes:
+  //   0  uint16 best move, 0 for none. As in Polyglot books: destination square
+  //      in bits 0-5, origin in bits 6-11, promotion piece (1 knight, 2 bishop,
+  //      3 rook, 4 queen) in bits 12-14, castling coded as king captures rook.
+  //   2  int16 score in centipawns, or 30000 - N for mate in N plies (negative
+  //      if mated)
+  //   4  Completed depth
+  //   5  Flags, see BatchFlag
+  //   6  uint16 reserved
+  //   8  uint64 nodes searched
+
+  const size_t RequestSize = 48;
+  const size_t ResponseSize = 16;
+  const size_t QueueSize = 64; // Requests decoded ahead of the search
+
+  enum BatchFlag { INVALID_REQUEST = 1, NO_LEGAL_MOVES = 2 };
+
+  struct Request {
+    Position pos;
+    Search::LimitsType limits;
+    bool valid;
+  };
+
+  // The requests are read and decoded by a separate thread, so that the next
+  // ones are ready while the current one is searched. They are queued by pointer
+  // because a Position must not be copy constructed.
+  struct RequestQueue {
+    Mutex mutex;
+    ConditionVariable notEmpty, notFull;
+    std::deque<Request*> requests;
+    bool eof;
+    NativeHandle handle;
+  };
+
+  // decode() sets up the position and the limits of a request. It returns false
+  // if they are not valid: wrong piece codes or number of kings, pawns on the
+  // first or last rank, castling rights or en passant square not matching the
+  // board, side not to move in check, or no limit.
+  bool decode(const unsigned char* r, Request& req) {
+
+    static const char* PieceToChar = " PNBRQK  pnbrqk";
+    static const char* CastleToChar = "KQkq";
+    static const Square CastleKing[] = { SQ_E1, SQ_E1, SQ_E8, SQ_E8 };
+    static const Square CastleRook[] = { SQ_H1, SQ_A1, SQ_H8, SQ_A8 };
+
+    Piece board[64];
+    int kings[2] = { 0, 0 };
+    Color us = r[32] ? BLACK : WHITE;
+    ostringstream fen;
+
+    for (Square s = SQ_A1; s <= SQ_H8; s++)
+    {
+        int pc = (r[s / 2] >> (4 * (s & 1))) & 0xF;
+
+        if (pc == 7 || pc == 8 || pc == 15)
+            return false;
+
+        board[s] = pc ? Piece(pc) : NO_PIECE;
+
+        if (!pc)
+            continue;
+
+        if (type_of(board[s]) == KING)
+            kings[color_of(board[s])]++;
+
+        if (type_of(board[s]) == PAWN && (rank_of(s) == RANK_1 || rank_of(s) == RANK_8))
+            return false;
+    }
+
+    if (kings[WHITE] != 1 || kings[BLACK] != 1 || r[32] > 1 || r[33] > ALL_CASTLES || r[34] > 64)
+        return false;
+
+    for (Rank rank = RANK_8; rank >= RANK_1; rank--)
+    {
+        int empty = 0;
+
+        for (File file = FILE_A; file <= FILE_H; file++)
+        {
+            Piece pc = board[file | rank];
+
+            if (pc == NO_PIECE)
+                empty++;
+            else
+            {
+                if (empty)
+                    fen << empty;
+
+                fen << PieceToChar[pc];
+                empty = 0;
+            }
+        }
+
+        if (empty)
+            fen << empty;
+
+        fen << (rank > RANK_1 ? '/' : ' ');
+    }
+
+    fen << (us == WHITE ? "w " : "b ");
+
+    for (int i = 0; i < 4; i++)
+        if (r[33] & (1 << i))
+        {
+            if (   board[CastleKing[i]] != make_piece(i < 2 ? WHITE : BLACK, KING)
+                || board[CastleRook[i]] != make_piece(i < 2 ? WHITE : BLACK, ROOK))
+                return false;
+
+            fen << CastleToChar[i];
+        }
+
+    if (!r[33])
+        fen << '-';
+
+    // The en passant square must be empty on the sixth rank, behind a pawn just
+    // pushed by two squares.
+    if (r[34] != 64)
+    {
+        Square ep = Square(r[34]);
+
+        if (   relative_rank(us, ep) != RANK_6
+            || board[ep] != NO_PIECE
+            || board[ep + pawn_push(us)] != NO_PIECE
+            || board[ep - pawn_push(us)] != make_piece(~us, PAWN))
+            return false;
+
+        fen << ' ' << square_to_string(ep);
+    }
+    else
+        fen << " -";
+
+    fen << ' ' << int(r[35]) << " 1";
+
+    req.pos.from_fen(fen.str(), false, Threads.main_thread());
+
+    if (req.pos.attackers_to(req.pos.king_square(~us)) & req.pos.pieces(us))
+        return false;
+
+    req.limits.depth    = get_le<uint16_t>(r + 36);
+    req.limits.movetime = int(min(get_le<uint32_t>(r + 40), uint32_t(INT_MAX)));
+    req.limits.nodes    = int(min(get_le<uint32_t>(r + 44), uint32_t(INT_MAX)));
+
+    return req.limits.depth || req.limits.movetime || req.limits.nodes;
+  }
+
+  // reader_loop() reads and decodes the requests until the end of the input,
+  // keeping at most QueueSize of them ahead of the search.
+  long reader_loop(RequestQueue* q) {
+
+    unsigned char buf[RequestSize];
+
+    while (cin.read((char*)buf, RequestSize))
+    {
+        Request* req = new Request;
+        req->valid = decode(buf, *req);
+
+        q->mutex.lock();
+
+        while (q->requests.size() >= QueueSize)
+            q->notFull.wait(q->mutex);
+
+        q->requests.push_back(req);
+        q->notEmpty.notify_one();
+        q->mutex.unlock();
+    }
+
+    q->mutex.lock();
+    q->eof = true;
+    q->notEmpty.notify_one();
+    q->mutex.unlock();
+
+    return 0;
+  }
+
+  // search() searches the position of a valid request and fills the response
+  void search(Request& req, unsigned char* res) {
+
+    Search::StateStackPtr states; // No setup moves
+    Threads.start_searching(req.pos, req.limits, vector<Move>(), states);
+    Threads.wait_for_search_finished();
+
+    const Search::RootMove& rm = Search::RootMoves[0];
+    Move m = rm.pv[0];
+    Value v = rm.score;
+
+    if (m == MOVE_NONE)
+    {
+        v = req.pos.in_check() ? -VALUE_MATE : VALUE_DRAW;
+        res[5] |= NO_LEGAL_MOVES;
+    }
+
+    int pt = type_of(m) == PROMOTION ? promotion_type(m) - 1 : 0;
+
+    put_le(res, uint16_t((m & 0xFFF) | (pt << 12)));
+    put_le(res + 2, int16_t(abs(v) < VALUE_MATE_IN_MAX_PLY ? v * 100 / int(PawnValueMg) : v));
+    res[4] = (unsigned char)Search::CompletedDepth;
+    put_le(res + 8, uint64_t(Search::RootPosition.nodes_searched()));
+  }
+
+} // namespace
+
+
+/// UCI::batch_loop() is the main loop of the "--batch" command line mode, an
+/// alternative to the UCI protocol for analysing large numbers of positions.
+/// It reads binary requests from stdin and writes binary responses to stdout,
+/// as described above, until the end of the input. The arguments set the UCI
+/// options, as name=value pairs.
+
+void UCI::batch_loop(const vector<string>& args) {
+
+  for (size_t i = 0; i < args.size(); i++)
+  {
+      size_t eq = args[i].find('=');
+      string name = args[i].substr(0, eq);
+
+      if (eq == string::npos || !Options.count(name))
+      {
+          cerr << "Unknown option: " << args[i] << endl;
+          return;
+      }
+
+      Options[name] = args[i].substr(eq + 1);
+  }
+
+#if defined(_WIN32) || defined(_WIN64)
+  _setmode(_fileno(stdin), _O_BINARY);
+  _setmode(_fileno(stdout), _O_BINARY);
+#endif
+
+  // The UCI output of the search is discarded, stdout is for the responses
+  streambuf* out = cout.rdbuf(NULL);
+
+  RequestQueue q;
+  q.eof = false;
+
+  if (!thread_create(q.handle, reader_loop, &q))
+  {
+      cerr << "Failed to create the batch reader thread" << endl;
+      exit(EXIT_FAILURE);
+  }
+
+  while (true)
+  {
+      q.mutex.lock();
+
+      while (q.requests.empty() && !q.eof)
+          q.notEmpty.wait(q.mutex);
+
+      if (q.requests.empty())
+      {
+          q.mutex.unlock();
+          break;
+      }
+
+      Request* req = q.requests.front();
+      q.requests.pop_front();
+      q.notFull.notify_one();
+      q.mutex.unlock();
+
+      unsigned char res[ResponseSize] = { 0 };
+
+      if (req->valid)
+          search(*req, res);
+      else
+          res[5] = INVALID_REQUEST;
+
+      delete req;
+
+      out->sputn((const char*)res, ResponseSize);
+
+      // Flush when waiting for the client, otherwise let the responses batch up
+      q.mutex.lock();
+      bool idle = q.requests.empty();
+      q.mutex.unlock();
+
+      if (idle)
+          out->pubsync();
+  }
+
+  thread_join(q.handle);
+  out->pubsync();
+  cout.rdbuf(out);
+}
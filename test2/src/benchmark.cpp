@@ -17,14 +17,27 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
+#include <cmath>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
 #include <istream>
+#include <sstream>
 #include <vector>
 
+#include "endgame.h"
+#include "evaluate.h"
+#include "material.h"
 #include "misc.h"
+#include "movegen.h"
+#include "movepick.h"
+#include "notation.h"
+#include "perf.h"
 #include "position.h"
+#include "rkiss.h"
 #include "search.h"
+#include "stats.h"
 #include "thread.h"
 #include "tt.h"
 #include "ucioption.h"
@@ -50,14 +63,435 @@ static const char* Defaults[] = {
   "3q2k1/pb3p1p/4pbp1/2r5/PpN2N2/1P2P2P/5PP1/Q2R2K1 b - - 4 26"
 };
 
+// Endgames with a high 50 moves counter, where most of the search is spent
+// shuffling pieces and repetition detection dominates. Selected with the
+// "endgames" file name argument.
+static const char* EndgameFens[] = {
+  "8/8/4k3/3p4/3P4/4K3/8/8 w - - 40 80",
+  "8/5k2/8/3R4/8/2r5/5K2/8 w - - 60 90",
+  "8/8/1p1k4/1P6/2K5/8/8/8 w - - 50 70",
+  "6k1/5p2/6p1/8/3B4/5PP1/6K1/1b6 w - - 70 95",
+  "8/8/8/4k3/8/3QK3/8/q7 w - - 30 80",
+  "1r6/5pk1/6p1/8/8/6P1/5PK1/R7 w - - 80 100",
+  "8/6k1/8/4N3/8/3K4/8/4r3 b - - 45 90",
+  "8/3k4/8/2b5/8/8/3BK3/8 w - - 20 60"
+};
+
+
+namespace {
+
+  // Two-sided 95% quantiles of the Student's t distribution, by degrees of
+  // freedom, for the confidence intervals of the bench suite.
+  const double TQuantile95[] = {
+    0, 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+    2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+    2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+  };
+
+  // Sample collects the measures of repeated runs
+  struct Sample {
+
+    void add(double x) { v.push_back(x); }
+
+    double mean() const {
+
+      double sum = 0;
+      for (size_t i = 0; i < v.size(); i++)
+          sum += v[i];
+
+      return v.empty() ? 0 : sum / v.size();
+    }
+
+    double stddev() const {
+
+      double m = mean(), sum = 0;
+      for (size_t i = 0; i < v.size(); i++)
+          sum += (v[i] - m) * (v[i] - m);
+
+      return v.size() < 2 ? 0 : sqrt(sum / (v.size() - 1));
+    }
+
+    // Half width of the 95% confidence interval of the mean
+    double ci95() const {
+
+      size_t df = v.size() - 1;
+      double t = df < sizeof(TQuantile95) / sizeof(double) ? TQuantile95[df] : 1.960;
+
+      return v.size() < 2 ? 0 : t * stddev() / sqrt(double(v.size()));
+    }
+
+    vector<double> v;
+  };
+
+  // PositionResult holds the measures of a position along the runs. The depth,
+  // best move and TT hit rate are the ones of the last run.
+  struct PositionResult {
+
+    PositionResult() : nodes(0), depth(0), best(MOVE_NONE), ttHitRate(-1) {}
+
+    Sample time, nps;
+    int64_t nodes;
+    int depth;
+    Move best;
+    double ttHitRate; // Negative when not available
+  };
+
+
+  // setup_bench() reads the arguments shared by all the benchmark modes, after
+  // the hash size and the number of threads, sets the hash size and the threads,
+  // and loads the positions. It returns the limit type.
+
+  string setup_bench(const Position& current, istream& is, const string& ttSize,
+                     const string& threads, Search::LimitsType& limits, vector<string>& fens) {
+    string token;
+
+    // Assign default values to missing arguments
+    string limit     = (is >> token) ? token : "12";
+    string fenFile   = (is >> token) ? token : "default";
+    string limitType = (is >> token) ? token : "depth";
+
+    Options["Hash"]    = ttSize;
+    Options["Threads"] = threads;
+    TT.clear();
+
+    if (limitType == "time")
+        limits.movetime = 1000 * atoi(limit.c_str()); // movetime is in ms
+
+    else if (limitType == "nodes")
+        limits.nodes = atoi(limit.c_str());
+
+    else
+        limits.depth = atoi(limit.c_str());
+
+    if (fenFile == "default")
+        fens.assign(Defaults, Defaults + 16);
+
+    else if (fenFile == "endgames")
+        fens.assign(EndgameFens, EndgameFens + 8);
+
+    else if (fenFile == "current")
+        fens.push_back(current.to_fen());
+
+    else
+    {
+        string fen;
+        ifstream file(fenFile.c_str());
+
+        if (!file.is_open())
+        {
+            cerr << "Unable to open file " << fenFile << endl;
+            exit(EXIT_FAILURE);
+        }
+
+        while (getline(file, fen))
+            if (!fen.empty())
+                fens.push_back(fen);
+
+        file.close();
+    }
+
+    return limitType;
+  }
+
+
+  // json_string() quotes a string for the JSON output
+  string json_string(const string& str) {
+
+    string s = "\"";
+
+    for (size_t i = 0; i < str.size(); i++)
+    {
+        if (str[i] == '"' || str[i] == '\\')
+            s += '\\';
+
+        s += str[i];
+    }
+
+    return s + "\"";
+  }
+
+  string json_sample(const Sample& s) {
+
+    stringstream ss;
+    ss << fixed << setprecision(1)
+       << "{ \"mean\": " << s.mean() << ", \"stddev\": " << s.stddev()
+       << ", \"ci95\": " << s.ci95() << " }";
+    return ss.str();
+  }
+
+
+  // bench_suite() is called by "bench suite": it runs the benchmark a number of
+  // times, clearing the hash table before each run, and reports the statistics
+  // of every position and of the totals on stderr, and as JSON in a file named
+  // by the last argument, "bench.json" by default.
+
+  void bench_suite(const Position& current, istream& is) {
+
+    string token;
+    Search::LimitsType limits;
+    vector<string> fens;
+
+    int runs         = (is >> token) ? max(atoi(token.c_str()), 1) : 5;
+    string ttSize    = (is >> token) ? token : "128";
+    string threads   = (is >> token) ? token : "1";
+    string limitType = setup_bench(current, is, ttSize, threads, limits, fens);
+    string jsonFile  = (is >> token) ? token : "bench.json";
+
+    vector<PositionResult> results(fens.size());
+    Sample totalTime, totalNps;
+    int64_t totalNodes = 0;
+    Search::StateStackPtr st;
+
+    for (int r = 0; r < runs; r++)
+    {
+        int64_t nodes = 0;
+        Time::point runTime = 0;
+
+        TT.clear();
+        cerr << "\nRun " << r + 1 << '/' << runs << endl;
+
+        for (size_t i = 0; i < fens.size(); i++)
+        {
+            Position pos(fens[i], Options["UCI_Chess960"], Threads.main_thread());
+            PositionResult& res = results[i];
+            Time::point elapsed = Time::now();
+
+            Stats::clear();
+
+            for (size_t j = 0; j < Threads.size(); j++)
+                Threads[j].ttProbes = Threads[j].ttHits = 0;
+
+            if (limitType == "perft")
+            {
+                res.nodes = Search::perft(pos, limits.depth * ONE_PLY);
+                res.depth = limits.depth;
+            }
+            else
+            {
+                Threads.start_searching(pos, limits, vector<Move>(), st);
+                Threads.wait_for_search_finished();
+
+                int64_t probes = 0, hits = 0;
+
+                for (size_t j = 0; j < Threads.size(); j++)
+                {
+                    probes += Threads[j].ttProbes;
+                    hits += Threads[j].ttHits;
+                }
+
+                res.nodes = Search::RootPosition.nodes_searched();
+                res.depth = Search::CompletedDepth;
+                res.best = Search::RootMoves[0].pv[0];
+                res.ttHitRate = probes ? double(hits) / probes : -1;
+            }
+
+            elapsed = Time::now() - elapsed + 1;
+
+            res.time.add(double(elapsed));
+            res.nps.add(1000.0 * res.nodes / elapsed);
+            nodes += res.nodes;
+            runTime += elapsed;
+        }
+
+        totalTime.add(double(runTime));
+        totalNps.add(1000.0 * nodes / runTime);
+        totalNodes = nodes;
+    }
+
+    cerr << "\n===========================\n"
+         << "  #  Time (ms)       Nodes         NPS  +/- %  Depth  TT hits  Best move\n";
+
+    for (size_t i = 0; i < fens.size(); i++)
+    {
+        const PositionResult& res = results[i];
+
+        cerr << right << setw(3) << i + 1
+             << setw(11) << fixed << setprecision(0) << res.time.mean()
+             << setw(12) << res.nodes
+             << setw(12) << res.nps.mean()
+             << setw(7)  << setprecision(1) << 100 * res.nps.ci95() / max(res.nps.mean(), 1.0)
+             << setw(7)  << res.depth
+             << setw(8);
+
+        if (res.ttHitRate >= 0)
+            cerr << 100 * res.ttHitRate << "%";
+        else
+            cerr << "n/a" << " ";
+
+        cerr << "  " << move_to_uci(res.best, Options["UCI_Chess960"]) << "\n";
+    }
+
+    cerr << fixed << setprecision(0)
+         << "\nRuns            : " << runs
+         << "\nTotal time (ms) : " << totalTime.mean() << " +/- " << totalTime.ci95()
+         << "\nNodes searched  : " << totalNodes
+         << "\nNodes/second    : " << totalNps.mean() << " +/- " << totalNps.ci95()
+         << " (" << setprecision(2) << 100 * totalNps.ci95() / max(totalNps.mean(), 1.0)
+         << "%, 95% confidence, stddev " << setprecision(0) << totalNps.stddev() << ")" << endl;
+
+    ofstream json(jsonFile.c_str());
+
+    json << "{\n  \"engine\": " << json_string(engine_info())
+         << ",\n  \"hash\": " << Options["Hash"]
+         << ",\n  \"threads\": " << Options["Threads"]
+         << ",\n  \"limit\": " << (limits.depth ? limits.depth : limits.nodes ? limits.nodes : limits.movetime)
+         << ",\n  \"limitType\": " << json_string(limitType)
+         << ",\n  \"runs\": " << runs
+         << ",\n  \"positions\": [";
+
+    for (size_t i = 0; i < fens.size(); i++)
+    {
+        const PositionResult& res = results[i];
+
+        json << (i ? "," : "") << "\n    { \"fen\": " << json_string(fens[i])
+             << ", \"nodes\": " << res.nodes
+             << ", \"depth\": " << res.depth
+             << ", \"bestMove\": " << json_string(move_to_uci(res.best, Options["UCI_Chess960"]))
+             << ", \"ttHitRate\": ";
+
+        if (res.ttHitRate >= 0)
+            json << fixed << setprecision(4) << res.ttHitRate;
+        else
+            json << "null";
+
+        json << ",\n      \"timeMs\": " << json_sample(res.time)
+             << ", \"nps\": " << json_sample(res.nps) << " }";
+    }
+
+    json << "\n  ],\n  \"total\": { \"nodes\": " << totalNodes
+         << ", \"timeMs\": " << json_sample(totalTime)
+         << ", \"nps\": " << json_sample(totalNps) << " }\n}\n";
+
+    if (!json)
+        cerr << "Unable to write file " << jsonFile << endl;
+  }
+
+
+  // bench_scaling() is called by "bench scaling": it runs the benchmark with
+  // one thread and then with every number of threads up to the given one, by
+  // default the number of cores, and prints a table of the parallel search
+  // efficiency. Speedup is the time to reach the limit compared with a single
+  // thread, and overhead the extra nodes searched to reach it, so both are only
+  // meaningful with a depth limit. Idle time is the share of the threads' time
+  // spent waiting for work. Splits are counted only with -DUSE_STATS. Perft is
+  // rejected, it does not use the threads.
+
+  void bench_scaling(const Position& current, istream& is) {
+
+    string token;
+    Search::LimitsType limits;
+    vector<string> fens;
+    stringstream cpus;
+
+    cpus << min(cpu_count(), MAX_THREADS);
+
+    string userThreads = Options["Threads"]; // Restored at the end
+    string ttSize      = (is >> token) ? token : "128";
+    string threads     = (is >> token) ? token : cpus.str();
+    string limitType   = setup_bench(current, is, ttSize, threads, limits, fens);
+    bool fixedWork     = limitType != "time";
+
+    if (limitType == "perft") // Single threaded, nothing to scale
+    {
+        cerr << "Bench scaling does not support perft, use depth, nodes or time" << endl;
+        Options["Threads"] = userThreads;
+        return;
+    }
+
+    int maxThreads = Options["Threads"];
+    vector<int64_t> times, nodes;
+    stringstream table;
+    Search::StateStackPtr st;
+
+    table << "\nThreads  Time (ms)       Nodes         NPS  NPS x  Speedup  Efficiency"
+          << "  Overhead   Idle"
+#if defined(USE_STATS)
+          << "     Splits"
+#endif
+          << "\n";
+
+    for (int n = 1; n <= maxThreads; n++)
+    {
+        stringstream ss;
+        ss << n;
+        Options["Threads"] = ss.str(); // Calls ThreadPool::read_uci_options()
+
+        TT.clear();
+        Stats::clear();
+
+        for (size_t i = 0; i < Threads.size(); i++)
+            Threads[i].busyTime = 0;
+
+        int64_t elapsed = 0, cnt = 0, busy = 0;
+
+        cerr << "\nThreads: " << n << endl;
+
+        for (size_t i = 0; i < fens.size(); i++)
+        {
+            Position pos(fens[i], Options["UCI_Chess960"], Threads.main_thread());
+            int64_t t = Time::now_us();
+
+            Threads.start_searching(pos, limits, vector<Move>(), st);
+            Threads.wait_for_search_finished();
+
+            elapsed += Time::now_us() - t;
+            cnt += Search::RootPosition.nodes_searched();
+        }
+
+        for (size_t i = 0; i < Threads.size(); i++)
+            busy += Threads[i].busyTime;
+
+        elapsed = max(elapsed, int64_t(1));
+        times.push_back(elapsed);
+        nodes.push_back(cnt);
+
+        double nps = 1000000.0 * cnt / elapsed;
+        double nps1 = 1000000.0 * nodes[0] / times[0];
+        double speedup = double(times[0]) / elapsed;
+
+        table << setw(7) << n
+              << setw(11) << elapsed / 1000
+              << setw(12) << cnt
+              << setw(12) << fixed << setprecision(0) << nps
+              << setw(7) << setprecision(2) << nps / nps1;
+
+        if (fixedWork)
+            table << setw(9) << speedup
+                  << setw(11) << setprecision(1) << 100 * speedup / n << "%"
+                  << setw(9) << showpos << 100.0 * cnt / nodes[0] - 100 << noshowpos << "%";
+        else
+            table << setw(9) << "n/a" << setw(12) << "n/a" << setw(10) << "n/a";
+
+        table << setw(6) << setprecision(1) << max(100.0 - 100.0 * busy / (double(n) * elapsed), 0.0) << "%";
+
+#if defined(USE_STATS)
+        table << setw(11) << Stats::total(Stats::SPLITS);
+#endif
+
+        table << "\n";
+    }
+
+    cerr << "\n===========================" << table.str() << endl;
+
+    Options["Threads"] = userThreads;
+  }
+
+} // namespace
+
 
 /// benchmark() runs a simple benchmark by letting Stockfish analyze a set
-/// of positions for a given limit each. There are five parameters; the
+/// of positions for a given limit each. There are six parameters; the
 /// transposition table size, the number of search threads that should
 /// be used, the limit value spent for each position (optional, default is
 /// depth 12), an optional file name where to look for positions in fen
-/// format (defaults are the positions defined above) and the type of the
-/// limit value: depth (default), time in secs or number of nodes.
+/// format (defaults are the positions defined above, "endgames" selects the
+/// shuffling endgames instead), the type of the limit value: depth (default),
+/// time in secs or number of nodes, and "perf" to report the hardware events
+/// per node, as cache misses, counted by the cpu along the benchmark.
+/// With "suite" as first parameter, followed by the number of runs, the usual
+/// parameters and a JSON file name, the statistics of repeated runs are
+/// reported instead. With "scaling" the benchmark is repeated for each number
+/// of threads up to the given one, to measure the parallel search efficiency.
 
 void benchmark(const Position& current, istream& is) {
 
@@ -65,54 +499,32 @@ void benchmark(const Position& current, istream& is) {
   Search::LimitsType limits;
   vector<string> fens;
 
-  // Assign default values to missing arguments
-  string ttSize    = (is >> token) ? token : "128";
-  string threads   = (is >> token) ? token : "1";
-  string limit     = (is >> token) ? token : "12";
-  string fenFile   = (is >> token) ? token : "default";
-  string limitType = (is >> token) ? token : "depth";
-
-  Options["Hash"]    = ttSize;
-  Options["Threads"] = threads;
-  TT.clear();
-
-  if (limitType == "time")
-      limits.movetime = 1000 * atoi(limit.c_str()); // movetime is in ms
-
-  else if (limitType == "nodes")
-      limits.nodes = atoi(limit.c_str());
-
-  else
-      limits.depth = atoi(limit.c_str());
-
-  if (fenFile == "default")
-      fens.assign(Defaults, Defaults + 16);
+  string ttSize = (is >> token) ? token : "128";
 
-  else if (fenFile == "current")
-      fens.push_back(current.to_fen());
-
-  else
+  if (ttSize == "suite")
   {
-      string fen;
-      ifstream file(fenFile.c_str());
-
-      if (!file.is_open())
-      {
-          cerr << "Unable to open file " << fenFile << endl;
-          exit(EXIT_FAILURE);
-      }
-
-      while (getline(file, fen))
-          if (!fen.empty())
-              fens.push_back(fen);
+      bench_suite(current, is);
+      return;
+  }
 
-      file.close();
+  if (ttSize == "scaling")
+  {
+      bench_scaling(current, is);
+      return;
   }
 
+  string threads   = (is >> token) ? token : "1";
+  string limitType = setup_bench(current, is, ttSize, threads, limits, fens);
+  bool perf        = (is >> token) && token == "perf";
+
   int64_t nodes = 0;
   Search::StateStackPtr st;
+  PerfCounters counters;
   Time::point elapsed = Time::now();
 
+  if (perf)
+      counters.start();
+
   for (size_t i = 0; i < fens.size(); i++)
   {
       Position pos(fens[i], Options["UCI_Chess960"], Threads.main_thread());
@@ -135,8 +547,882 @@ void benchmark(const Position& current, istream& is) {
 
   elapsed = Time::now() - elapsed + 1; // Assure positive to avoid a 'divide by zero'
 
+  if (perf)
+      counters.stop();
+
   cerr << "\n==========================="
        << "\nTotal time (ms) : " << elapsed
        << "\nNodes searched  : " << nodes
        << "\nNodes/second    : " << 1000 * nodes / elapsed << endl;
+
+  if (perf)
+      for (int e = 0; e < PerfCounters::EVENT_NB; e++)
+      {
+          PerfCounters::Event ev = PerfCounters::Event(e);
+
+          cerr << left << setw(16) << PerfCounters::name(ev) << right << ": ";
+
+          if (counters.available(ev))
+              cerr << fixed << setprecision(2) << double(counters.value(ev)) / max(nodes, int64_t(1))
+                   << " per node" << endl;
+          else
+              cerr << "n/a" << endl;
+      }
+}
+
+
+namespace {
+
+  // scalar_evaluate() is the reference for evaluate_batch(): a plain loop over
+  // from_fen() and evaluate() with each position as root. Returns the time
+  // taken in microseconds.
+
+  int64_t scalar_evaluate(const vector<string>& fens, bool chess960, vector<Value>& values) {
+
+    Position pos;
+    Value margin;
+    Color rootColor = Eval::RootColor;
+    int64_t elapsed = Time::now_us();
+
+    values.resize(fens.size());
+
+    for (size_t i = 0; i < fens.size(); i++)
+    {
+        pos.from_fen(fens[i], chess960, Threads.main_thread());
+
+        if (pos.in_check())
+            values[i] = VALUE_NONE;
+        else
+        {
+            Eval::RootColor = pos.side_to_move();
+            values[i] = Eval::evaluate(pos, margin);
+        }
+    }
+
+    Eval::RootColor = rootColor;
+    return Time::now_us() - elapsed;
+  }
+
+} // namespace
+
+
+/// eval_batch() prints the static evaluation of every position in a file of
+/// fen strings, one value per line in the same order, in internal units from
+/// the point of view of the side to move ("none" for positions in check). The
+/// file is processed in chunks so that arbitrarily large files can be labeled.
+/// With "compare" each chunk is evaluated a second time by a plain loop over
+/// Position::from_fen() and Eval::evaluate(), the values are checked to match
+/// and the speed of both paths is reported.
+
+void eval_batch(istream& is) {
+
+  const size_t ChunkSize = 4096;
+
+  string fenFile, fen, token;
+  vector<string> fens;
+  vector<Value> values, scalarValues;
+  int64_t cnt = 0, chunks = 0, mismatches = 0, batchTime = 0, scalarTime = 0;
+  bool chess960 = Options["UCI_Chess960"];
+
+  is >> fenFile;
+  bool compare = (is >> token) && token == "compare";
+  ifstream file(fenFile.c_str());
+
+  if (!file.is_open())
+  {
+      cerr << "Unable to open file " << fenFile << endl;
+      return;
+  }
+
+  Threads.wait_for_search_finished();
+
+  Time::point elapsed = Time::now();
+
+  while (true)
+  {
+      fens.clear();
+
+      while (fens.size() < ChunkSize && getline(file, fen))
+          if (!fen.empty())
+              fens.push_back(fen);
+
+      if (fens.empty())
+          break;
+
+      // The second path finds the pawn and material entries of the chunk
+      // already computed, so in compare mode the order alternates by chunk.
+      bool scalarFirst = compare && (chunks++ & 1);
+
+      if (scalarFirst)
+          scalarTime += scalar_evaluate(fens, chess960, scalarValues);
+
+      int64_t t = Time::now_us();
+
+      Eval::evaluate_batch(fens, chess960, values);
+
+      batchTime += Time::now_us() - t;
+
+      if (compare && !scalarFirst)
+          scalarTime += scalar_evaluate(fens, chess960, scalarValues);
+
+      if (compare)
+          for (size_t i = 0; i < fens.size(); i++)
+              mismatches += values[i] != scalarValues[i];
+
+      stringstream ss;
+
+      for (size_t i = 0; i < values.size(); i++)
+      {
+          if (i)
+              ss << "\n";
+
+          if (values[i] == VALUE_NONE)
+              ss << "none";
+          else
+              ss << values[i];
+      }
+
+      sync_cout << ss.str() << sync_endl;
+      cnt += values.size();
+  }
+
+  elapsed = Time::now() - elapsed + 1; // Assure positive to avoid a 'divide by zero'
+
+  cerr << "\n==========================="
+       << "\nTotal time (ms)      : " << elapsed
+       << "\nPositions evaluated  : " << cnt
+       << "\nPositions/second     : " << 1000 * cnt / elapsed << endl;
+
+  if (compare)
+      cerr << "Batch positions/s    : " << 1000000 * cnt / max(batchTime, int64_t(1))
+           << "\nScalar positions/s   : " << 1000000 * cnt / max(scalarTime, int64_t(1))
+           << "\nMismatches           : " << mismatches << endl;
+}
+
+
+/// material_bench() measures the cost of a material table miss, by computing
+/// again all the directly indexed configurations, and the cost of the endgame
+/// function lookups such a miss does, by probing the endgames registry with
+/// material keys of random configurations of few pieces. The only parameter is
+/// the number of passes, 20 by default.
+
+void material_bench(istream& is) {
+
+  const int Keys = 1 << 16;
+
+  string token;
+  int passes = (is >> token) ? atoi(token.c_str()) : 20;
+  vector<Key> keys(Keys);
+  Endgames endgames;
+  RKISS rk;
+  int64_t found = 0;
+
+  for (int i = 0; i < Keys; i++)
+  {
+      Key k = 0;
+
+      for (Color c = WHITE; c <= BLACK; c++)
+          for (PieceType pt = PAWN; pt <= QUEEN; pt++)
+              for (int cnt = rk.rand<unsigned>() % (pt == PAWN ? 3 : 2); cnt > 0; cnt--)
+                  k ^= Zobrist::psq[c][pt][cnt - 1];
+
+      keys[i] = k;
+  }
+
+  Threads.wait_for_search_finished();
+
+  Time::point missTime = Time::now();
+
+  for (int p = 0; p < passes; p++)
+      MaterialTable::init();
+
+  missTime = Time::now() - missTime + 1;
+
+  Time::point probeTime = Time::now();
+
+  for (int p = 0; p < 16 * passes; p++)
+      for (int i = 0; i < Keys; i++)
+      {
+          EndgameBase<Value>* ev;
+          EndgameBase<ScaleFactor>* sf;
+
+          found += (endgames.probe(keys[i], ev) != NULL) + (endgames.probe(keys[i], sf) != NULL);
+      }
+
+  probeTime = Time::now() - probeTime + 1;
+
+  int64_t misses = int64_t(passes) * MaterialConfigurations;
+  int64_t probes = int64_t(16 * passes) * Keys * 2;
+
+  cerr << "\n==========================="
+       << "\nMaterial misses      : " << misses
+       << "\nTime per miss (ns)   : " << 1000000.0 * missTime / misses
+       << "\nEndgame probes       : " << probes << " (" << found << " found)"
+       << "\nTime per probe (ns)  : " << 1000000.0 * probeTime / probes << endl;
+}
+
+
+namespace {
+
+  // The primitives timed by micro_bench(). Each functor runs its primitive on
+  // a position of the corpus, given with its legal moves, and returns the
+  // number of operations done. Results go to Sink, so that the compiler can not
+  // optimize the calls away.
+
+  volatile int64_t Sink;
+
+  template<GenType Type>
+  struct Generate {
+    int64_t operator()(Position& pos, const vector<Move>&) {
+
+      if (Type != LEGAL && pos.in_check() != (Type == EVASIONS))
+          return 0;
+
+      MoveStack mlist[MAX_MOVES];
+      Sink += generate<Type>(pos, mlist) - mlist;
+      return 1;
+    }
+  };
+
+  struct DoUndoMove {
+    int64_t operator()(Position& pos, const vector<Move>& moves) {
+
+      StateInfo st;
+      CheckInfo ci(pos);
+
+      for (size_t i = 0; i < moves.size(); i++)
+      {
+          pos.do_move(moves[i], st, ci, pos.move_gives_check(moves[i], ci));
+          pos.undo_move(moves[i]);
+      }
+      return moves.size();
+    }
+  };
+
+  struct See {
+    int64_t operator()(Position& pos, const vector<Move>& moves) {
+
+      int64_t cnt = 0;
+
+      for (size_t i = 0; i < moves.size(); i++)
+          if (pos.is_capture(moves[i]))
+          {
+              Sink += pos.see(moves[i]);
+              cnt++;
+          }
+      return cnt;
+    }
+  };
+
+  struct Evaluate {
+    int64_t operator()(Position& pos, const vector<Move>&) {
+
+      Value margin;
+
+      if (pos.in_check())
+          return 0;
+
+      Sink += Eval::evaluate(pos, margin);
+      return 1;
+    }
+  };
+
+  struct TTProbe {
+    TTProbe(const vector<Key>& k) : keys(k), idx(0) {}
+
+    int64_t operator()(Position&, const vector<Move>&) {
+
+      for (int i = 0; i < 16; i++)
+          Sink += TT.probe(keys[idx++ & (keys.size() - 1)]) != NULL;
+      return 16;
+    }
+
+    const vector<Key>& keys;
+    size_t idx;
+  };
+
+  struct PawnProbe {
+    int64_t operator()(Position& pos, const vector<Move>&) {
+      Sink += pos.this_thread()->pawnTable.probe(pos)->pawns_value();
+      return 1;
+    }
+  };
+
+  struct MaterialProbe {
+    int64_t operator()(Position& pos, const vector<Move>&) {
+      Sink += pos.this_thread()->materialTable.probe(pos)->material_value();
+      return 1;
+    }
+  };
+
+  struct GivesCheck {
+    int64_t operator()(Position& pos, const vector<Move>& moves) {
+
+      CheckInfo ci(pos);
+
+      for (size_t i = 0; i < moves.size(); i++)
+          Sink += pos.move_gives_check(moves[i], ci);
+      return moves.size();
+    }
+  };
+
+  struct NextMove {
+    NextMove() { memset(ss, 0, sizeof(ss)); h.clear(); }
+
+    int64_t operator()(Position& pos, const vector<Move>&) {
+
+      MovePicker mp(pos, MOVE_NONE, 6 * ONE_PLY, h, ss, VALUE_INFINITE);
+      int64_t cnt = 0;
+
+      while (mp.next_move<false>() != MOVE_NONE)
+          cnt++;
+      return cnt;
+    }
+
+    Search::Stack ss[1];
+    History h;
+  };
+
+
+  // measure() runs a primitive over the corpus for at least the given time and
+  // prints the time and, when available, the hardware events per operation.
+
+  template<typename F>
+  void measure(const string& name, F f, Position* positions,
+               const vector<vector<Move> >& moves, int ms) {
+
+    PerfCounters counters;
+    int64_t ops = 0;
+    Time::point elapsed = Time::now();
+
+    counters.start();
+
+    do {
+        for (size_t i = 0; i < moves.size(); i++)
+            ops += f(positions[i], moves[i]);
+
+    } while (Time::now() - elapsed < ms);
+
+    counters.stop();
+    elapsed = Time::now() - elapsed;
+
+    cerr << left << setw(26) << name << right
+         << setw(12) << ops
+         << setw(10) << fixed << setprecision(1) << 1000000.0 * elapsed / max(ops, int64_t(1));
+
+    PerfCounters::Event events[] = {
+      PerfCounters::CYCLES, PerfCounters::INSTRUCTIONS,
+      PerfCounters::CACHE_MISSES, PerfCounters::BRANCH_MISSES
+    };
+
+    for (int e = 0; e < 4; e++)
+        if (counters.available(events[e]))
+            cerr << setw(e < 2 ? 10 : 12) << setprecision(e < 2 ? 0 : 2)
+                 << double(counters.value(events[e])) / max(ops, int64_t(1));
+        else
+            cerr << setw(e < 2 ? 10 : 12) << "n/a";
+
+    cerr << endl;
+  }
+
+} // namespace
+
+
+/// micro_bench() times the hot primitives of the engine in isolation: move
+/// generation by type, do/undo move, SEE, evaluation, hash table probes, check
+/// detection and the move picker. The parameters are the minimum time in ms
+/// spent on each primitive, 500 by default, and an optional file of positions
+/// in fen format. Without a file the corpus is made of the benchmark positions
+/// and the positions along a few random games played from each of them.
+
+void micro_bench(istream& is) {
+
+  const int Playouts = 4;
+  const int PlayoutPlies = 16;
+
+  string token, fen;
+  int ms = (is >> token) ? atoi(token.c_str()) : 500;
+  vector<string> fens;
+  RKISS rk;
+
+  if (is >> token)
+  {
+      ifstream file(token.c_str());
+
+      if (!file.is_open())
+      {
+          cerr << "Unable to open file " << token << endl;
+          return;
+      }
+
+      while (getline(file, fen))
+          if (!fen.empty())
+              fens.push_back(fen);
+  }
+  else
+  {
+      vector<string> seeds(Defaults, Defaults + 16);
+      seeds.insert(seeds.end(), EndgameFens, EndgameFens + 8);
+
+      for (size_t i = 0; i < seeds.size(); i++)
+      {
+          fens.push_back(seeds[i]);
+
+          for (int p = 0; p < Playouts; p++)
+          {
+              Position pos(seeds[i], false, Threads.main_thread());
+              StateInfo st[PlayoutPlies];
+
+              for (int ply = 0; ply < PlayoutPlies; ply++)
+              {
+                  MoveList<LEGAL> ml(pos);
+
+                  if (!ml.size())
+                      break;
+
+                  for (int n = rk.rand<unsigned>() % ml.size(); n > 0; n--)
+                      ++ml;
+
+                  pos.do_move(ml.move(), st[ply]);
+                  fens.push_back(pos.to_fen());
+              }
+          }
+      }
+  }
+
+  Threads.wait_for_search_finished();
+
+  Position* positions = new Position[fens.size()];
+  vector<vector<Move> > moves(fens.size());
+  vector<Key> keys(1 << 20);
+
+  for (size_t i = 0; i < fens.size(); i++)
+  {
+      positions[i].from_fen(fens[i], Options["UCI_Chess960"], Threads.main_thread());
+
+      for (MoveList<LEGAL> ml(positions[i]); !ml.end(); ++ml)
+          moves[i].push_back(ml.move());
+  }
+
+  for (size_t i = 0; i < keys.size(); i++)
+      keys[i] = rk.rand<Key>();
+
+  cerr << "\nPositions: " << fens.size() << ", hash: " << Options["Hash"] << " MB\n\n"
+       << left << setw(26) << "Primitive" << right << setw(12) << "Operations"
+       << setw(10) << "ns/op" << setw(10) << "cycles" << setw(10) << "instr"
+       << setw(12) << "cache miss" << setw(12) << "branch miss" << endl;
+
+  measure("generate<CAPTURES>",     Generate<CAPTURES>(),     positions, moves, ms);
+  measure("generate<QUIETS>",       Generate<QUIETS>(),       positions, moves, ms);
+  measure("generate<QUIET_CHECKS>", Generate<QUIET_CHECKS>(), positions, moves, ms);
+  measure("generate<EVASIONS>",     Generate<EVASIONS>(),     positions, moves, ms);
+  measure("generate<NON_EVASIONS>", Generate<NON_EVASIONS>(), positions, moves, ms);
+  measure("generate<LEGAL>",        Generate<LEGAL>(),        positions, moves, ms);
+  measure("do_move + undo_move",    DoUndoMove(),             positions, moves, ms);
+  measure("see",                    See(),                    positions, moves, ms);
+  measure("move_gives_check",       GivesCheck(),             positions, moves, ms);
+  measure("MovePicker::next_move",  NextMove(),               positions, moves, ms);
+  measure("TT.probe",               TTProbe(keys),            positions, moves, ms);
+  measure("PawnTable::probe",       PawnProbe(),              positions, moves, ms);
+  measure("MaterialTable::probe",   MaterialProbe(),          positions, moves, ms);
+
+  // Every evaluation would be an eval cache hit after the first pass
+  Threads.main_thread()->evalCache.set_size(0);
+  measure("evaluate",               Evaluate(),               positions, moves, ms);
+  Threads.main_thread()->evalCache.set_size(Options["Eval Cache"]);
+
+  delete [] positions;
+}
+
+
+namespace {
+
+  // Well known perft positions with their leaf node counts: the initial one,
+  // Kiwipete and the other positions of the chessprogramming wiki, positions
+  // testing the en passant, castling, promotion and discovered check corner
+  // cases, and Chess960 positions with castling rights given by rook file.
+  struct PerftEntry {
+    const char* fen;
+    bool chess960;
+    int depth;
+    uint64_t nodes;
+  };
+
+  const PerftEntry PerftSuite[] = {
+    { "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1", false, 5, 4865609 },
+    { "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1", false, 4, 4085603 },
+    { "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", false, 6, 11030083 },
+    { "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1", false, 5, 15833292 },
+    { "r2q1rk1/pP1p2pp/Q4n2/bbp1p3/Np6/1B3NBn/pPPP1PPP/R3K2R b KQ - 0 1", false, 5, 15833292 },
+    { "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8", false, 4, 2103487 },
+    { "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10", false, 4, 3894594 },
+    { "3k4/3p4/8/K1P4r/8/8/8/8 b - - 0 1", false, 6, 1134888 },
+    { "8/8/4k3/8/2p5/8/B2P2K1/8 w - - 0 1", false, 6, 1015133 },
+    { "8/8/1k6/2b5/2pP4/8/5K2/8 b - d3 0 1", false, 6, 1440467 },
+    { "5k2/8/8/8/8/8/8/4K2R w K - 0 1", false, 6, 661072 },
+    { "3k4/8/8/8/8/8/8/R3K3 w Q - 0 1", false, 6, 803711 },
+    { "r3k2r/1b4bq/8/8/8/8/7B/R3K2R w KQkq - 0 1", false, 4, 1274206 },
+    { "r3k2r/8/3Q4/8/8/5q2/8/R3K2R b KQkq - 0 1", false, 4, 1720476 },
+    { "2K2r2/4P3/8/8/8/8/8/3k4 w - - 0 1", false, 6, 3821001 },
+    { "8/8/1P2K3/8/2n5/1q6/8/5k2 b - - 0 1", false, 5, 1004658 },
+    { "4k3/1P6/8/8/8/8/K7/8 w - - 0 1", false, 6, 217342 },
+    { "8/P1k5/K7/8/8/8/8/8 w - - 0 1", false, 6, 92683 },
+    { "K1k5/8/P7/8/8/8/8/8 w - - 0 1", false, 6, 2217 },
+    { "8/k1P5/8/1K6/8/8/8/8 w - - 0 1", false, 7, 567584 },
+    { "8/8/2k5/5q2/5n2/8/5K2/8 b - - 0 1", false, 4, 23527 },
+    { "bqnb1rkr/pp3ppp/3ppn2/2p5/5P2/P2P4/NPP1P1PP/BQ1BNRKR w HFhf - 2 9", true, 5, 8146062 },
+    { "2nnrbkr/p1qppppp/8/1ppb4/6PP/3PP3/PPP2P2/BQNNRBKR w HEhe - 1 9", true, 5, 16253601 },
+    { "b1q1rrkb/pppppppp/3nn3/8/P7/1PPP4/4PPPP/BQNNRKRB w GE - 1 9", true, 5, 6417013 },
+    { "qbbnnrkr/2pp2pp/p7/1p2pp2/8/P3PP2/1PPP1KPP/QBBNNR1R w hf - 0 9", true, 5, 9183776 },
+    { "1nbbnrkr/p1p1ppp1/3p4/1p3P1p/3Pq2P/8/PPP1P1P1/QNBBNRKR w HFhf - 0 9", true, 5, 34030312 }
+  };
+
+  const size_t PerftSuiteSize = sizeof(PerftSuite) / sizeof(PerftEntry);
+
+  // The work is split by root move, so that the big positions are shared among
+  // the threads. Jobs are taken in order by the first free thread.
+  struct PerftJob {
+    size_t entry;
+    Move move;
+    uint64_t nodes;
+  };
+
+  struct PerftWork {
+    Lock lock; // Protects next
+    size_t next;
+    vector<PerftJob> jobs;
+  };
+
+  bool bigger_entry(size_t a, size_t b) { return PerftSuite[a].nodes > PerftSuite[b].nodes; }
+
+  long perft_worker(PerftWork* pw) {
+
+    while (true)
+    {
+        lock_grab(pw->lock);
+        size_t i = pw->next++;
+        lock_release(pw->lock);
+
+        if (i >= pw->jobs.size())
+            return 0;
+
+        PerftJob& job = pw->jobs[i];
+        const PerftEntry& e = PerftSuite[job.entry];
+        Position pos(e.fen, e.chess960, NULL); // Never evaluated
+        StateInfo st;
+
+        pos.do_move(job.move, st);
+        job.nodes = e.depth > 1 ? Search::perft(pos, (e.depth - 1) * ONE_PLY) : 1;
+    }
+  }
+
+} // namespace
+
+
+/// perft_suite() is called by the "perft suite" command. It runs perft on the
+/// positions above, with the given number of threads or else the "Threads"
+/// option, and reports the positions whose leaf node count is not the expected
+/// one, together with the speed in millions of nodes per second.
+
+void perft_suite(istream& is) {
+
+  string token;
+  int threads = (is >> token) ? atoi(token.c_str()) : int(Options["Threads"]);
+  vector<size_t> order(PerftSuiteSize);
+  PerftWork pw;
+
+  Threads.wait_for_search_finished();
+
+  for (size_t i = 0; i < PerftSuiteSize; i++)
+      order[i] = i;
+
+  // Start with the biggest positions to keep all the threads busy until the end
+  stable_sort(order.begin(), order.end(), bigger_entry);
+
+  for (size_t i = 0; i < PerftSuiteSize; i++)
+  {
+      Position pos(PerftSuite[order[i]].fen, PerftSuite[order[i]].chess960, Threads.main_thread());
+
+      for (MoveList<LEGAL> ml(pos); !ml.end(); ++ml)
+      {
+          PerftJob job = { order[i], ml.move(), 0 };
+          pw.jobs.push_back(job);
+      }
+  }
+
+  lock_init(pw.lock);
+  pw.next = 0;
+
+  vector<NativeHandle> handles(max(threads, 1));
+  int64_t elapsed = Time::now_us();
+
+  for (size_t i = 1; i < handles.size(); i++)
+      if (!thread_create(handles[i], perft_worker, &pw))
+      {
+          cerr << "Failed to create a perft thread" << endl;
+          exit(EXIT_FAILURE);
+      }
+
+  perft_worker(&pw);
+
+  for (size_t i = 1; i < handles.size(); i++)
+      thread_join(handles[i]);
+
+  elapsed = max(Time::now_us() - elapsed, int64_t(1));
+  lock_destroy(pw.lock);
+
+  vector<uint64_t> counts(PerftSuiteSize, 0);
+  uint64_t total = 0;
+  int failed = 0;
+
+  for (size_t i = 0; i < pw.jobs.size(); i++)
+      counts[pw.jobs[i].entry] += pw.jobs[i].nodes;
+
+  for (size_t i = 0; i < PerftSuiteSize; i++)
+  {
+      const PerftEntry& e = PerftSuite[i];
+      bool ok = counts[i] == e.nodes;
+
+      cerr << (ok ? "ok      " : "FAILED  ") << "perft " << e.depth
+           << setw(11) << counts[i];
+
+      if (!ok)
+          cerr << " (expected " << e.nodes << ")";
+
+      cerr << "  " << e.fen << endl;
+
+      total += counts[i];
+      failed += !ok;
+  }
+
+  cerr << "\n==========================="
+       << "\nPositions       : " << PerftSuiteSize << " (" << failed << " failed)"
+       << "\nThreads         : " << handles.size()
+       << "\nTotal time (ms) : " << elapsed / 1000
+       << "\nLeaf nodes      : " << total
+       << "\nMnps            : " << fixed << setprecision(1) << double(total) / elapsed << endl;
+}
+
+
+namespace {
+
+  // EpdEntry stores a test position with the operations we use from it: the
+  // best moves ("bm"), the moves to avoid ("am") and the position name ("id").
+
+  struct EpdEntry {
+    string fen, id;
+    vector<Move> bm, am;
+  };
+
+  // EpdResult stores the outcome of the search of an EpdEntry. The solution
+  // time and depth are the ones of the first iteration from which the best
+  // move was always a correct one until the end of the search.
+
+  struct EpdResult {
+    bool solved;
+    Move best;
+    int depth;
+    Time::point time;
+  };
+
+  bool is_solution(const EpdEntry& e, Move m) {
+
+    return   m != MOVE_NONE
+          && (e.bm.empty() || find(e.bm.begin(), e.bm.end(), m) != e.bm.end())
+          && find(e.am.begin(), e.am.end(), m) == e.am.end();
+  }
+
+
+  // parse_epd() reads the four FEN fields of an EPD line followed by the list
+  // of its ';' terminated operations. Moves are in SAN, as the EPD standard
+  // requires, or else in coordinate notation. Returns false on a malformed line
+  // or when there is nothing to check.
+
+  bool parse_epd(const string& line, EpdEntry& e, bool chess960) {
+
+    istringstream is(line);
+    string token, op;
+
+    for (int i = 0; i < 4 && is >> token; i++)
+        e.fen += token + " ";
+
+    if (count(e.fen.begin(), e.fen.end(), ' ') < 4)
+        return false;
+
+    e.fen += "0 1";
+    Position pos(e.fen, chess960, Threads.main_thread());
+
+    while (getline(is, op, ';'))
+    {
+        istringstream ops(op);
+
+        if (!(ops >> token))
+            continue;
+
+        if (token == "id")
+        {
+            getline(ops >> ws, e.id);
+            e.id.erase(remove(e.id.begin(), e.id.end(), '"'), e.id.end());
+        }
+        else if (token == "bm" || token == "am")
+        {
+            vector<Move>& moves = (token == "bm" ? e.bm : e.am);
+
+            while (ops >> token)
+            {
+                Move m = move_from_san(pos, token);
+
+                if (m == MOVE_NONE)
+                    m = move_from_uci(pos, token);
+
+                if (m == MOVE_NONE)
+                    return false;
+
+                moves.push_back(m);
+            }
+        }
+    }
+
+    return !e.bm.empty() || !e.am.empty();
+  }
+
+} // namespace
+
+
+/// epd_suite() is called by the "epd" command. It searches each position of
+/// an EPD test suite for the given time with the current options and checks
+/// the best move against the "bm" and "am" operations. For every solved
+/// position it reports the time and depth at which the solution was found for
+/// good, then how many positions were solved within each time threshold.
+
+void epd_suite(istream& is) {
+
+  string fileName, line;
+  int ms = 1000;
+
+  if (!(is >> fileName))
+  {
+      cerr << "Usage: epd <file> [ms]" << endl;
+      return;
+  }
+
+  is >> ms;
+  ms = max(ms, 1);
+
+  ifstream file(fileName.c_str());
+
+  if (!file.is_open())
+  {
+      cerr << "Unable to open file " << fileName << endl;
+      return;
+  }
+
+  vector<EpdEntry> entries;
+  bool chess960 = Options["UCI_Chess960"];
+
+  Threads.wait_for_search_finished();
+
+  while (getline(file, line))
+  {
+      EpdEntry e;
+
+      if (parse_epd(line, e, chess960))
+          entries.push_back(e);
+
+      else if (line.find_first_not_of(" \t\r") != string::npos)
+          cerr << "Skipping EPD line: " << line << endl;
+  }
+
+  vector<EpdResult> results(entries.size());
+  Search::LimitsType limits;
+  Search::StateStackPtr st;
+  int solved = 0;
+
+  limits.movetime = ms;
+
+  // Positions are searched one after the other with all the search threads,
+  // because the root moves, the signals and the thread pool are all global.
+  for (size_t i = 0; i < entries.size(); i++)
+  {
+      const EpdEntry& e = entries[i];
+      Position pos(e.fen, chess960, Threads.main_thread());
+      EpdResult& res = results[i];
+
+      cerr << "\nPosition: " << i + 1 << '/' << entries.size() << ' ' << e.id << endl;
+
+      TT.clear();
+      Threads.start_searching(pos, limits, vector<Move>(), st);
+      Threads.wait_for_search_finished();
+
+      res.best = Search::RootMoves.empty() ? MOVE_NONE : Search::RootMoves[0].pv[0];
+      res.solved = is_solution(e, res.best);
+      res.depth = 0;
+      res.time = ms;
+
+      if (!res.solved)
+          continue;
+
+      const vector<Search::IterationInfo>& it = Search::Iterations;
+
+      // The best move can change in the last, interrupted, iteration
+      if (it.empty() || it.back().move != res.best)
+          res.depth = Search::CompletedDepth + 1;
+
+      else
+      {
+          size_t k = it.size();
+
+          while (k > 0 && is_solution(e, it[k - 1].move))
+              k--;
+
+          res.depth = it[k].depth;
+          res.time = min(it[k].elapsed, Time::point(ms));
+      }
+
+      solved++;
+  }
+
+  cerr << "\n==========================="
+       << "\n  #  Result  Time (ms)  Depth  Best move  Id\n";
+
+  for (size_t i = 0; i < entries.size(); i++)
+  {
+      const EpdResult& res = results[i];
+      Position pos(entries[i].fen, chess960, Threads.main_thread());
+
+      cerr << right << setw(3) << i + 1 << "  " << (res.solved ? "ok    " : "FAILED");
+
+      if (res.solved)
+          cerr << setw(11) << res.time << setw(7) << res.depth;
+      else
+          cerr << setw(11) << "-" << setw(7) << "-";
+
+      cerr << "  " << left << setw(9)
+           << (res.best != MOVE_NONE ? move_to_san(pos, res.best) : "none")
+           << "  " << entries[i].id << endl;
+  }
+
+  // Solve rate as a function of the time, doubling the threshold each step
+  cerr << "\n  Time (ms)  Solved   Rate\n";
+
+  for (int t = min(10, ms); ; t = min(2 * t, ms))
+  {
+      int cnt = 0;
+
+      for (size_t i = 0; i < results.size(); i++)
+          cnt += results[i].solved && results[i].time <= t;
+
+      cerr << right << setw(11) << t << setw(8) << cnt
+           << setw(6) << fixed << setprecision(1)
+           << 100.0 * cnt / max(entries.size(), size_t(1)) << "%" << endl;
+
+      if (t >= ms)
+          break;
+  }
+
+  cerr << "\n==========================="
+       << "\nPositions       : " << entries.size()
+       << "\nSolved          : " << solved
+       << "\nTime per move   : " << ms << " ms"
+       << "\nThreads         : " << Threads.size() << endl;
 }
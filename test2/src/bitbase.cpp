@@ -17,9 +17,14 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <cassert>
+#include <iomanip>
+#include <iostream>
+#include <vector>
 
 #include "bitboard.h"
+#include "misc.h"
 #include "types.h"
 
 namespace {
@@ -55,12 +60,13 @@ namespace {
   // The possible pawns squares are 24, the first 4 files and ranks from 2 to 7
   const int IndexMax = 2 * 24 * 64 * 64; // stm * wp_sq * wk_sq * bk_sq = 196608
 
-  // Each uint32_t stores results of 32 positions, one per bit
-  uint32_t KPKBitbase[IndexMax / 32];
-
   int index(Square wksq, Square bksq, Square psq, Color stm);
+  void compute_kpk(uint32_t bitbase[]);
 }
 
+// Each uint32_t of KPKBitbase[] stores results of 32 positions, one per bit
+#include "kpktab.h"
+
 
 uint32_t Bitbases::probe_kpk(Square wksq, Square wpsq, Square bksq, Color stm) {
 
@@ -69,32 +75,70 @@ uint32_t Bitbases::probe_kpk(Square wksq, Square wpsq, Square bksq, Color stm) {
 }
 
 
-void Bitbases::init_kpk() {
+/// Bitbases::verify_kpk() computes again the KPK bitbase and returns true if
+/// it is the same as the precomputed one in kpktab.h.
+
+bool Bitbases::verify_kpk() {
+
+  std::vector<uint32_t> bitbase(IndexMax / 32);
+
+  compute_kpk(&bitbase[0]);
+
+  return std::equal(bitbase.begin(), bitbase.end(), KPKBitbase);
+}
+
+
+/// Bitbases::print_kpk() prints the computed KPK bitbase in the format of the
+/// kpktab.h table.
+
+void Bitbases::print_kpk() {
+
+  std::vector<uint32_t> bitbase(IndexMax / 32);
 
-  Result db[IndexMax];
-  KPKPosition pos;
-  int idx, bit, repeat = 1;
+  compute_kpk(&bitbase[0]);
 
-  // Initialize table with known win / draw positions
-  for (idx = 0; idx < IndexMax; idx++)
-      db[idx] = pos.classify_leaf(idx);
+  sync_cout;
 
-  // Iterate until all positions are classified (30 cycles needed)
-  while (repeat)
-      for (repeat = idx = 0; idx < IndexMax; idx++)
-          if (db[idx] == UNKNOWN && (db[idx] = pos.classify(idx, db)) != UNKNOWN)
-              repeat = 1;
+  for (int idx = 0; idx < IndexMax / 32; idx++)
+      std::cout << "0x" << std::hex << std::setfill('0') << std::setw(8) << bitbase[idx]
+                << std::dec << (idx % 8 == 7 ? ",\n" : ", ");
 
-  // Map 32 position results into one KPKBitbase[] entry
-  for (idx = 0; idx < IndexMax / 32; idx++)
-      for (bit = 0; bit < 32; bit++)
-          if (db[32 * idx + bit] == WIN)
-              KPKBitbase[idx] |= 1 << bit;
+  std::cout << sync_endl;
 }
 
 
 namespace {
 
+  // compute_kpk() classifies all the KPK positions by retrograde analysis and
+  // stores the win / no win results in the given bitbase.
+
+  void compute_kpk(uint32_t bitbase[]) {
+
+    std::vector<Result> db(IndexMax);
+    KPKPosition pos;
+    int idx, bit, repeat = 1;
+
+    // Initialize table with known win / draw positions
+    for (idx = 0; idx < IndexMax; idx++)
+        db[idx] = pos.classify_leaf(idx);
+
+    // Iterate until all positions are classified (30 cycles needed)
+    while (repeat)
+        for (repeat = idx = 0; idx < IndexMax; idx++)
+            if (db[idx] == UNKNOWN && (db[idx] = pos.classify(idx, &db[0])) != UNKNOWN)
+                repeat = 1;
+
+    // Map 32 position results into one bitbase[] entry
+    for (idx = 0; idx < IndexMax / 32; idx++)
+    {
+        bitbase[idx] = 0;
+
+        for (bit = 0; bit < 32; bit++)
+            if (db[32 * idx + bit] == WIN)
+                bitbase[idx] |= 1 << bit;
+    }
+  }
+
   // A KPK bitbase index is an integer in [0, IndexMax] range
   //
   // Information is mapped in this way
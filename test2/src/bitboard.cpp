@@ -19,10 +19,12 @@
 
 #include <algorithm>
 #include <cstring>
+#include <iomanip>
 #include <iostream>
 
 #include "bitboard.h"
 #include "bitcount.h"
+#include "magictab.h"
 #include "misc.h"
 #include "rkiss.h"
 
@@ -32,11 +34,13 @@ Bitboard RMasks[64];
 Bitboard RMagics[64];
 Bitboard* RAttacks[64];
 unsigned RShifts[64];
+uint16_t* RAttacks16[64];
 
 Bitboard BMasks[64];
 Bitboard BMagics[64];
 Bitboard* BAttacks[64];
 unsigned BShifts[64];
+uint16_t* BAttacks16[64];
 
 Bitboard SquareBB[64];
 Bitboard FileBB[8];
@@ -45,14 +49,15 @@ Bitboard AdjacentFilesBB[8];
 Bitboard ThisAndAdjacentFilesBB[8];
 Bitboard InFrontBB[2][8];
 Bitboard StepAttacksBB[16][64];
-Bitboard BetweenBB[64][64];
+Bitboard RayBB[9][64];
+uint8_t RayDirection[240];
 Bitboard DistanceRingsBB[64][8];
 Bitboard ForwardBB[2][64];
 Bitboard PassedPawnMask[2][64];
 Bitboard AttackSpanMask[2][64];
 Bitboard PseudoAttacks[6][64];
 
-int SquareDistance[64][64];
+uint8_t SquareDistance[64][64];
 
 namespace {
 
@@ -66,12 +71,21 @@ namespace {
   Square BSFTable[64];
   Bitboard RTable[0x19000]; // Storage space for rook attacks
   Bitboard BTable[0x1480];  // Storage space for bishop attacks
+#if defined(USE_PEXT)
+  uint16_t RTable16[0x19000]; // Compressed rook attacks, with pext
+  uint16_t BTable16[0x1480];  // Compressed bishop attacks, with pext
+#endif
   uint8_t BitCount8Bit[256];
 
   typedef unsigned (Fn)(Square, Bitboard);
 
-  void init_magics(Bitboard table[], Bitboard* attacks[], Bitboard magics[],
-                   Bitboard masks[], unsigned shifts[], Square deltas[], Fn index);
+  Bitboard sliding_attack(Square deltas[], Square sq, Bitboard occupied);
+  void init_magics(Bitboard table[], Bitboard* attacks[], Bitboard magics[], Bitboard masks[],
+                   unsigned shifts[], Square deltas[], Fn index, const Bitboard known[]);
+#if defined(USE_PEXT)
+  void compact_attacks(uint16_t table16[], uint16_t* attacks16[], Bitboard* attacks[],
+                       Bitboard masks[], PieceType pt);
+#endif
 
   FORCE_INLINE unsigned bsf_index(Bitboard b) {
 
@@ -149,6 +163,49 @@ void Bitboards::print(Bitboard b) {
 }
 
 
+/// Bitboards::verify_magics() searches again for the magics, with the same
+/// random sequence used to generate magictab.h, and rebuilds the attack tables
+/// with them. It returns true if they are the precomputed ones. Must not be
+/// called while searching.
+
+bool Bitboards::verify_magics() {
+
+  Square RDeltas[] = { DELTA_N,  DELTA_E,  DELTA_S,  DELTA_W  };
+  Square BDeltas[] = { DELTA_NE, DELTA_SE, DELTA_SW, DELTA_NW };
+
+  init_magics(RTable, RAttacks, RMagics, RMasks, RShifts, RDeltas, magic_index<ROOK>, NULL);
+  init_magics(BTable, BAttacks, BMagics, BMasks, BShifts, BDeltas, magic_index<BISHOP>, NULL);
+
+  for (Square s = SQ_A1; s <= SQ_H8; s++)
+      if (RMagics[s] != RookMagics[Is64Bit][s] || BMagics[s] != BishopMagics[Is64Bit][s])
+          return false;
+
+  return true;
+}
+
+
+/// Bitboards::print_magics() prints the magics in use, after verify_magics()
+/// they are the searched ones, in the format of the magictab.h tables.
+
+void Bitboards::print_magics() {
+
+  const Bitboard* magics[] = { RMagics, BMagics };
+
+  sync_cout;
+
+  for (int i = 0; i < 2; i++)
+  {
+      std::cout << (i ? "Bishop" : "Rook") << (Is64Bit ? " 64" : " 32") << " bit\n";
+
+      for (Square s = SQ_A1; s <= SQ_H8; s++)
+          std::cout << "0x" << std::hex << std::setfill('0') << std::setw(16) << magics[i][s]
+                    << std::dec << "ULL" << (s % 4 == 3 ? ",\n" : ", ");
+  }
+
+  std::cout << sync_endl;
+}
+
+
 /// Bitboards::init() initializes various bitboard arrays. It is called during
 /// program initialization.
 
@@ -220,23 +277,39 @@ void Bitboards::init() {
   Square RDeltas[] = { DELTA_N,  DELTA_E,  DELTA_S,  DELTA_W  };
   Square BDeltas[] = { DELTA_NE, DELTA_SE, DELTA_SW, DELTA_NW };
 
-  init_magics(RTable, RAttacks, RMagics, RMasks, RShifts, RDeltas, magic_index<ROOK>);
-  init_magics(BTable, BAttacks, BMagics, BMasks, BShifts, BDeltas, magic_index<BISHOP>);
-
   for (Square s = SQ_A1; s <= SQ_H8; s++)
   {
-      PseudoAttacks[QUEEN][s]  = PseudoAttacks[BISHOP][s] = attacks_bb<BISHOP>(s, 0);
-      PseudoAttacks[QUEEN][s] |= PseudoAttacks[  ROOK][s] = attacks_bb<  ROOK>(s, 0);
+      PseudoAttacks[QUEEN][s]  = PseudoAttacks[BISHOP][s] = sliding_attack(BDeltas, s, 0);
+      PseudoAttacks[QUEEN][s] |= PseudoAttacks[  ROOK][s] = sliding_attack(RDeltas, s, 0);
   }
 
-  for (Square s1 = SQ_A1; s1 <= SQ_H8; s1++)
-      for (Square s2 = SQ_A1; s2 <= SQ_H8; s2++)
-          if (PseudoAttacks[QUEEN][s1] & s2)
-          {
-              Square delta = (s2 - s1) / square_distance(s1, s2);
+  init_magics(RTable, RAttacks, RMagics, RMasks, RShifts, RDeltas, magic_index<ROOK>, RookMagics[Is64Bit]);
+  init_magics(BTable, BAttacks, BMagics, BMasks, BShifts, BDeltas, magic_index<BISHOP>, BishopMagics[Is64Bit]);
+
+#if defined(USE_PEXT)
+  if (HasPext)
+  {
+      compact_attacks(RTable16, RAttacks16, RAttacks, RMasks, ROOK);
+      compact_attacks(BTable16, BAttacks16, BAttacks, BMasks, BISHOP);
+  }
+#endif
+
+  // RayBB[d][s] are the squares from 's' to the edge of the board in the
+  // direction 'd', and RayDirection[] maps the 0x88 difference of two aligned
+  // squares to the direction going from the first to the second one.
+  Square Directions[] = { DELTA_N, DELTA_NE, DELTA_E, DELTA_SE,
+                          DELTA_S, DELTA_SW, DELTA_W, DELTA_NW };
+
+  std::fill(RayDirection, RayDirection + 240, 8);
 
-              for (Square s = s1 + delta; s != s2; s += delta)
-                  BetweenBB[s1][s2] |= s;
+  for (int d = 0; d < 8; d++)
+      for (Square s1 = SQ_A1; s1 <= SQ_H8; s1++)
+          for (Square s = s1 + Directions[d];
+               is_ok(s) && square_distance(s, s - Directions[d]) == 1;
+               s += Directions[d])
+          {
+              RayBB[d][s1] |= s;
+              RayDirection[119 + (s + (s & 56)) - (s1 + (s1 & 56))] = uint8_t(d);
           }
 }
 
@@ -279,10 +352,11 @@ namespace {
   // init_magics() computes all rook and bishop attacks at startup. Magic
   // bitboards are used to look up attacks of sliding pieces. As a reference see
   // chessprogramming.wikispaces.com/Magic+Bitboards. In particular, here we
-  // use the so called "fancy" approach.
+  // use the so called "fancy" approach. The magics are the known ones from
+  // magictab.h, unless 'known' is NULL and they are searched for again.
 
-  void init_magics(Bitboard table[], Bitboard* attacks[], Bitboard magics[],
-                   Bitboard masks[], unsigned shifts[], Square deltas[], Fn index) {
+  void init_magics(Bitboard table[], Bitboard* attacks[], Bitboard magics[], Bitboard masks[],
+                   unsigned shifts[], Square deltas[], Fn index, const Bitboard known[]) {
 
     int MagicBoosters[][8] = { { 3191, 2184, 1310, 3618, 2091, 1308, 2452, 3996 },
                                { 1059, 3608,  605, 3234, 3326,   38, 2029, 3043 } };
@@ -320,13 +394,27 @@ namespace {
         if (s < SQ_H8)
             attacks[s + 1] = attacks[s] + size;
 
+        // With pext the index is the occupancy compressed to the mask bits,
+        // that is already a perfect mapping, so there is no magic to look for.
+        if (HasPext)
+        {
+            for (i = 0; i < size; i++)
+                attacks[s][index(s, occupancy[i])] = reference[i];
+
+            continue;
+        }
+
         booster = MagicBoosters[Is64Bit][rank_of(s)];
 
         // Find a magic for square 's' picking up an (almost) random number
-        // until we find the one that passes the verification test.
+        // until we find the one that passes the verification test. A known
+        // magic passes it at the first try.
         do {
-            do magics[s] = pick_random(rk, booster);
-            while (BitCount8Bit[(magics[s] * masks[s]) >> 56] < 6);
+            if (known)
+                magics[s] = known[s];
+            else
+                do magics[s] = pick_random(rk, booster);
+                while (BitCount8Bit[(magics[s] * masks[s]) >> 56] < 6);
 
             memset(attacks[s], 0, size * sizeof(Bitboard));
 
@@ -345,7 +433,32 @@ namespace {
 
                 attack = reference[i];
             }
+            assert(!known || i == size);
+
         } while (i != size);
     }
   }
+
+
+#if defined(USE_PEXT)
+  // compact_attacks() stores, for the pext indexing, the attacks compressed to
+  // the bits of the empty board attacks, that fit in 16 bits. See attacks_bb().
+
+  void compact_attacks(uint16_t table16[], uint16_t* attacks16[], Bitboard* attacks[],
+                       Bitboard masks[], PieceType pt) {
+
+    attacks16[SQ_A1] = table16;
+
+    for (Square s = SQ_A1; s <= SQ_H8; s++)
+    {
+        int size = 1 << popcount<Max15>(masks[s]);
+
+        for (int i = 0; i < size; i++)
+            attacks16[s][i] = uint16_t(pext(attacks[s][i], PseudoAttacks[pt][s]));
+
+        if (s < SQ_H8)
+            attacks16[s + 1] = attacks16[s] + size;
+    }
+  }
+#endif
 }
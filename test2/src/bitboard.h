@@ -27,12 +27,15 @@ namespace Bitboards {
 
 void init();
 void print(Bitboard b);
+bool verify_magics();
+void print_magics();
 
 }
 
 namespace Bitbases {
 
-void init_kpk();
+bool verify_kpk();
+void print_kpk();
 uint32_t probe_kpk(Square wksq, Square wpsq, Square bksq, Color stm);
 
 }
@@ -43,11 +46,13 @@ extern Bitboard RMasks[64];
 extern Bitboard RMagics[64];
 extern Bitboard* RAttacks[64];
 extern unsigned RShifts[64];
+extern uint16_t* RAttacks16[64];
 
 extern Bitboard BMasks[64];
 extern Bitboard BMagics[64];
 extern Bitboard* BAttacks[64];
 extern unsigned BShifts[64];
+extern uint16_t* BAttacks16[64];
 
 extern Bitboard SquareBB[64];
 extern Bitboard FileBB[8];
@@ -56,7 +61,8 @@ extern Bitboard AdjacentFilesBB[8];
 extern Bitboard ThisAndAdjacentFilesBB[8];
 extern Bitboard InFrontBB[2][8];
 extern Bitboard StepAttacksBB[16][64];
-extern Bitboard BetweenBB[64][64];
+extern Bitboard RayBB[9][64];
+extern uint8_t RayDirection[240];
 extern Bitboard DistanceRingsBB[64][8];
 extern Bitboard ForwardBB[2][64];
 extern Bitboard PassedPawnMask[2][64];
@@ -149,10 +155,23 @@ inline Bitboard in_front_bb(Color c, Square s) {
 /// between_bb returns a bitboard representing all squares between two squares.
 /// For instance, between_bb(SQ_C4, SQ_F7) returns a bitboard with the bits for
 /// square d5 and e6 set.  If s1 and s2 are not on the same line, file or diagonal,
-/// 0 is returned.
+/// 0 is returned. Instead of a 32KB [64][64] table, it is derived from the rays
+/// in the direction going from s1 to s2, that is looked up by the difference of
+/// the squares in 0x88 coordinates: RayBB[8] is the empty ray of unaligned squares.
 
 inline Bitboard between_bb(Square s1, Square s2) {
-  return BetweenBB[s1][s2];
+  const Bitboard* ray = RayBB[RayDirection[119 + (s2 + (s2 & 56)) - (s1 + (s1 & 56))]];
+  return (ray[s1] ^ ray[s2]) & ~SquareBB[s2];
+}
+
+
+/// ray_bb returns a bitboard representing the squares from s1 (excluded) to the
+/// edge of the board, in the direction going to s2, or 0 if s1 and s2 are not
+/// on the same line, file or diagonal. For a piece on square s pinned to its
+/// king, ray_bb(ksq, s) contains all the squares where the piece can move.
+
+inline Bitboard ray_bb(Square s1, Square s2) {
+  return RayBB[RayDirection[119 + (s2 + (s2 & 56)) - (s1 + (s1 & 56))]][s1];
 }
 
 
@@ -190,7 +209,7 @@ inline Bitboard attack_span_mask(Color c, Square s) {
 /// either on a straight or on a diagonal line.
 
 inline bool squares_aligned(Square s1, Square s2, Square s3) {
-  return  (BetweenBB[s1][s2] | BetweenBB[s1][s3] | BetweenBB[s2][s3])
+  return  (between_bb(s1, s2) | between_bb(s1, s3) | between_bb(s2, s3))
         & (     SquareBB[s1] |      SquareBB[s2] |      SquareBB[s3]);
 }
 
@@ -214,6 +233,11 @@ FORCE_INLINE unsigned magic_index(Square s, Bitboard occ) {
   Bitboard* const Magics = Pt == ROOK ? RMagics : BMagics;
   unsigned* const Shifts = Pt == ROOK ? RShifts : BShifts;
 
+#if defined(USE_PEXT)
+  if (HasPext)
+      return unsigned(pext(occ, Masks[s]));
+#endif
+
   if (Is64Bit)
       return unsigned(((occ & Masks[s]) * Magics[s]) >> Shifts[s]);
 
@@ -222,8 +246,19 @@ FORCE_INLINE unsigned magic_index(Square s, Bitboard occ) {
   return (lo * unsigned(Magics[s]) ^ hi * unsigned(Magics[s] >> 32)) >> Shifts[s];
 }
 
+/// With pext the tables store the attacks compressed to 16 bits against the
+/// empty board attacks, that pdep expands back. This cuts the rook table from
+/// 800KB to 200KB, to have more of it in the L2 cache.
+
 template<PieceType Pt>
 inline Bitboard attacks_bb(Square s, Bitboard occ) {
+
+#if defined(USE_PEXT)
+  if (HasPext)
+      return pdep((Pt == ROOK ? RAttacks16 : BAttacks16)[s][magic_index<Pt>(s, occ)],
+                  PseudoAttacks[Pt][s]);
+#endif
+
   return (Pt == ROOK ? RAttacks : BAttacks)[s][magic_index<Pt>(s, occ)];
 }
 
@@ -25,11 +25,18 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <sstream>
 
 #include "book.h"
 #include "misc.h"
 #include "movegen.h"
+#include "notation.h"
+#include "thread.h"
+#include "ucioption.h"
 
 using namespace std;
 
@@ -45,6 +52,29 @@ namespace {
     uint32_t learn;
   };
 
+  // read_be() reads sizeof(T) bytes of the mapped file and converts them in a
+  // number of type T, advancing the pointer.
+  template<typename T> T read_be(const unsigned char*& p) {
+
+    T n = 0;
+    for (size_t i = 0; i < sizeof(T); i++)
+        n = T((n << 8) + *p++);
+
+    return n;
+  }
+
+  BookEntry read_entry(const unsigned char* p) {
+
+    BookEntry e;
+    e.key   = read_be<uint64_t>(p);
+    e.move  = read_be<uint16_t>(p);
+    e.count = read_be<uint16_t>(p);
+    e.learn = read_be<uint32_t>(p);
+    return e;
+  }
+
+  uint64_t read_key(const unsigned char* p) { return read_be<uint64_t>(p); }
+
   // Random numbers from PolyGlot, used to compute book hash keys
   const Key PolyGlotRandoms[781] = {
     0x9D39247E33776D41ULL, 0x2AF7398005AAA5C7ULL, 0x44DB015024623547ULL,
@@ -348,46 +378,51 @@ namespace {
 
 } // namespace
 
-PolyglotBook::PolyglotBook() {
+PolyglotBook::PolyglotBook() : data(NULL), mappedSize(0), entryCnt(0) {
 
   for (int i = Time::now() % 10000; i > 0; i--)
       RKiss.rand<unsigned>(); // Make random number generation less deterministic
 }
 
-PolyglotBook::~PolyglotBook() { if (is_open()) close(); }
+PolyglotBook::~PolyglotBook() { close(); }
 
 
-/// operator>>() reads sizeof(T) chars from the file's binary byte stream and
-/// converts them in a number of type T. A Polyglot book stores numbers in
-/// big-endian format.
+/// open() tries to map a book file with the given name after unmapping any
+/// existing one, and builds the sparse key index. This reads one page of the
+/// file every IndexStride entries.
 
-template<typename T> PolyglotBook& PolyglotBook::operator>>(T& n) {
+bool PolyglotBook::open(const char* fName) {
 
-  n = 0;
-  for (size_t i = 0; i < sizeof(T); i++)
-      n = T((n << 8) + ifstream::get());
+  close();
 
-  return *this;
-}
+  data = (const unsigned char*)map_file(fName, &mappedSize);
+  entryCnt = data ? size_t(mappedSize / sizeof(BookEntry)) : 0;
 
-template<> PolyglotBook& PolyglotBook::operator>>(BookEntry& e) {
-  return *this >> e.key >> e.move >> e.count >> e.learn;
-}
+  if (!entryCnt)
+  {
+      close();
+      return false;
+  }
 
+  for (size_t i = 0; i < entryCnt; i += IndexStride)
+      index.push_back(read_key(data + i * sizeof(BookEntry)));
 
-/// open() tries to open a book file with the given name after closing any
-/// exsisting one.
+  fileName = fName;
+  return true;
+}
 
-bool PolyglotBook::open(const char* fName) {
 
-  if (is_open()) // Cannot close an already closed file
-      close();
+/// close() unmaps the book file, if any.
 
-  ifstream::open(fName, ifstream::in | ifstream::binary);
+void PolyglotBook::close() {
 
-  fileName = is_open() ? fName : "";
-  ifstream::clear(); // Reset any error flag to allow retry ifstream::open()
-  return !fileName.empty();
+  if (data)
+      unmap_file(data, mappedSize);
+
+  data = NULL;
+  entryCnt = 0;
+  index.clear();
+  fileName = "";
 }
 
 
@@ -406,10 +441,13 @@ Move PolyglotBook::probe(const Position& pos, const string& fName, bool pickBest
   Move move = MOVE_NONE;
   uint64_t key = book_key(pos);
 
-  seekg(find_first(key) * sizeof(BookEntry), ios_base::beg);
-
-  while (*this >> e, e.key == key && good())
+  for (size_t i = find_first(key); i < entryCnt; i++)
   {
+      e = read_entry(data + i * sizeof(BookEntry));
+
+      if (e.key != key)
+          break;
+
       best = max(best, e.count);
       sum += e.count;
 
@@ -448,28 +486,28 @@ Move PolyglotBook::probe(const Position& pos, const string& fName, bool pickBest
 
 
 /// find_first() takes a book key as input, and does a binary search through
-/// the book file for the given key. Returns the index of the leftmost book
-/// entry with the same key as the input.
+/// the in-memory index and then through the range of entries of the mapped
+/// file between two index keys. Returns the index of the leftmost book entry
+/// with the same key as the input.
 
-size_t PolyglotBook::find_first(uint64_t key) {
+size_t PolyglotBook::find_first(uint64_t key) const {
 
-  seekg(0, ios::end); // Move pointer to end, so tellg() gets file's size
+  // First index key not less than the searched key: the leftmost entry lies
+  // between the previous index key and this one.
+  size_t idx = lower_bound(index.begin(), index.end(), key) - index.begin();
 
-  size_t low = 0, mid, high = (size_t)tellg() / sizeof(BookEntry) - 1;
-  BookEntry e;
+  size_t low = idx ? (idx - 1) * IndexStride : 0, mid;
+  size_t high = min(idx * IndexStride, entryCnt - 1);
 
   assert(low <= high);
 
-  while (low < high && good())
+  while (low < high)
   {
       mid = (low + high) / 2;
 
       assert(mid >= low && mid < high);
 
-      seekg(mid * sizeof(BookEntry), ios_base::beg);
-      *this >> e;
-
-      if (key <= e.key)
+      if (key <= read_key(data + mid * sizeof(BookEntry)))
           high = mid;
       else
           low = mid + 1;
@@ -479,3 +517,536 @@ size_t PolyglotBook::find_first(uint64_t key) {
 
   return low;
 }
+
+
+namespace {
+
+  // The book builder collects, for each position and move of the games, the
+  // number of games and the score of the side to move. The statistics are
+  // kept in hash tables sharded by the upper bits of the book key, so that the
+  // shards follow the key order and the threads rarely wait for the same lock.
+  // When a shard outgrows its share of the memory, its entries are sorted and
+  // written to disk as a run, and the runs are merged at the end.
+
+  const int ShardBits = 6;
+  const int ShardCnt = 1 << ShardBits;
+  const size_t ChunkSize = 4 * 1024 * 1024; // Bytes of PGN parsed per task
+
+  struct MoveStats {
+    uint32_t games; // Zero for an empty slot of the hash table
+    uint32_t score; // 2 points for a win, 1 for a draw
+  };
+
+  struct RunEntry {
+    uint64_t key;
+    uint16_t move;
+    MoveStats stats;
+
+    bool operator<(const RunEntry& e) const { return key < e.key || (key == e.key && move < e.move); }
+    bool same_move(const RunEntry& e) const { return key == e.key && move == e.move; }
+  };
+
+  // The runs on disk store each entry field by field, key, move, games and
+  // score, in little-endian order, so that they don't depend on the padding
+  // and the byte order of RunEntry.
+  const size_t RunRecordSize = 8 + 2 + 4 + 4;
+
+  void put_run_entry(unsigned char* p, const RunEntry& e) {
+
+    put_le(p, e.key);
+    put_le(p + 8, e.move);
+    put_le(p + 10, e.stats.games);
+    put_le(p + 14, e.stats.score);
+  }
+
+  // read_run_entry() reads the next entry of a run, returns false at the end
+  bool read_run_entry(ifstream& file, RunEntry& e) {
+
+    unsigned char r[RunRecordSize];
+
+    if (!file.read((char*)r, sizeof(r)))
+        return false;
+
+    e.key = get_le<uint64_t>(r);
+    e.move = get_le<uint16_t>(r + 8);
+    e.stats.games = get_le<uint32_t>(r + 10);
+    e.stats.score = get_le<uint32_t>(r + 14);
+    return true;
+  }
+
+  struct Shard {
+    Lock lock;
+    std::vector<RunEntry> table; // Open addressing with linear probing
+    size_t count;
+    std::vector<string> runs;
+  };
+
+  struct BookBuilder {
+    const char* pgn;
+    size_t pgnSize, next;
+    string bookFile;
+    int maxPly;
+    size_t maxShardSlots;
+    Lock lock; // Protects next, games and skipped
+    uint64_t games, skipped;
+    Shard shards[ShardCnt];
+  };
+
+  // polyglot_move() converts a Move to the Polyglot encoding described in
+  // PolyglotBook::probe(). Castling moves are already "king captures rook".
+  uint16_t polyglot_move(Move m) {
+
+    int pt = type_of(m) == PROMOTION ? promotion_type(m) - 1 : 0;
+    return uint16_t((m & 0xFFF) | (pt << 12));
+  }
+
+  // sorted_entries() returns the entries of the shard sorted by key and move,
+  // and empties it.
+  std::vector<RunEntry> sorted_entries(Shard& sh) {
+
+    std::vector<RunEntry> entries;
+    entries.reserve(sh.count);
+
+    for (size_t i = 0; i < sh.table.size(); i++)
+        if (sh.table[i].stats.games)
+        {
+            entries.push_back(sh.table[i]);
+            sh.table[i].stats.games = 0;
+        }
+
+    sh.count = 0;
+    std::sort(entries.begin(), entries.end());
+    return entries;
+  }
+
+  // spill() writes the shard to disk as a sorted run and empties it. Called
+  // with the shard lock held.
+  void spill(BookBuilder* bb, Shard& sh) {
+
+    std::ostringstream name;
+    name << bb->bookFile << ".run" << (&sh - bb->shards) << "." << sh.runs.size() << ".tmp";
+
+    std::vector<RunEntry> entries = sorted_entries(sh);
+    std::vector<unsigned char> buf(entries.size() * RunRecordSize);
+    ofstream file(name.str().c_str(), ios::out | ios::binary);
+
+    for (size_t i = 0; i < entries.size(); i++)
+        put_run_entry(&buf[i * RunRecordSize], entries[i]);
+
+    file.write((const char*)&buf[0], buf.size());
+
+    if (!file)
+    {
+        cerr << "Unable to write " << name.str() << endl;
+        exit(EXIT_FAILURE);
+    }
+
+    sh.runs.push_back(name.str());
+  }
+
+  // find_slot() returns the slot holding the move, or the empty one where it
+  // should be inserted.
+  RunEntry* find_slot(std::vector<RunEntry>& table, const RunEntry& e) {
+
+    size_t mask = table.size() - 1;
+    size_t idx = size_t(e.key ^ (e.move * 0x9E3779B97F4A7C15ULL)) & mask;
+
+    while (table[idx].stats.games && !table[idx].same_move(e))
+        idx = (idx + 1) & mask;
+
+    return &table[idx];
+  }
+
+  // add_move() adds the statistics of a move to its shard. A shard at 3/4 of
+  // its slots doubles them, or is spilled when already at its memory limit.
+  void add_move(BookBuilder* bb, const RunEntry& e) {
+
+    Shard& sh = bb->shards[e.key >> (64 - ShardBits)];
+
+    lock_grab(sh.lock);
+
+    RunEntry* slot = find_slot(sh.table, e);
+
+    if (slot->stats.games)
+    {
+        slot->stats.games += e.stats.games;
+        slot->stats.score += e.stats.score;
+    }
+    else
+    {
+        *slot = e;
+
+        if (++sh.count * 4 >= sh.table.size() * 3)
+        {
+            if (sh.table.size() >= bb->maxShardSlots)
+                spill(bb, sh);
+            else
+            {
+                std::vector<RunEntry> entries = sorted_entries(sh);
+
+                sh.table.assign(sh.table.size() * 2, RunEntry());
+                sh.count = entries.size();
+
+                for (size_t i = 0; i < entries.size(); i++)
+                    *find_slot(sh.table, entries[i]) = entries[i];
+            }
+        }
+    }
+
+    lock_release(sh.lock);
+  }
+
+  // game_start() returns the offset of the first game starting at or after
+  // 'from'. A game starts with the Event tag, as in the PGN export format.
+  size_t game_start(const BookBuilder* bb, size_t from) {
+
+    for (size_t i = from; i + 7 <= bb->pgnSize; i++)
+        if ((i == 0 || bb->pgn[i - 1] == '\n') && !strncmp(bb->pgn + i, "[Event ", 7))
+            return i;
+
+    return bb->pgnSize;
+  }
+
+  // tag_value() returns the value of the given tag in the tag section of the
+  // game, or an empty string if not found.
+  string tag_value(const char* begin, const char* end, const char* tag) {
+
+    string s(begin, end), pattern = string("[") + tag + " \"";
+    size_t start = s.find(pattern);
+
+    if (start == string::npos)
+        return "";
+
+    start += pattern.length();
+    return s.substr(start, s.find('"', start) - start);
+  }
+
+  // parse_game() replays the first plies of a game and adds its moves to the
+  // statistics. Games without a result or with an illegal move are skipped.
+  bool parse_game(BookBuilder* bb, const char* p, const char* end, std::vector<StateInfo>& states) {
+
+    const char* moves = p;
+
+    // Skip the tag section
+    while (moves < end && (*moves == '[' || isspace((unsigned char)*moves)))
+        moves = *moves == '[' ? std::find(moves, end, '\n') : moves + 1;
+
+    string result = tag_value(p, moves, "Result");
+    string fen = tag_value(p, moves, "FEN");
+    string variant = tag_value(p, moves, "Variant");
+    int whiteScore = result == "1-0" ? 2 : result == "1/2-1/2" ? 1 : result == "0-1" ? 0 : -1;
+
+    if (whiteScore < 0 || (!variant.empty() && variant != "Standard" && variant != "standard"))
+        return false;
+
+    Position pos(fen.empty() ? "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1" : fen,
+                 false, NULL); // Never evaluated, see Position::do_move()
+    std::vector<RunEntry> gameMoves;
+    gameMoves.reserve(bb->maxPly);
+    int ply = 0;
+
+    for (p = moves; p < end && ply < bb->maxPly; )
+    {
+        if (isspace((unsigned char)*p))
+            p++;
+
+        else if (*p == '{' || *p == ';') // Comments
+            p = std::min(std::find(p, end, *p == '{' ? '}' : '\n') + 1, end);
+
+        else if (*p == '(') // Variations, possibly nested
+        {
+            for (int depth = 0; p < end; p++)
+                if (*p == '(')
+                    depth++;
+                else if (*p == ')' && !--depth)
+                    break;
+
+            p = std::min(p + 1, end);
+        }
+        else
+        {
+            const char* tokenEnd = p + 1; // A stray ')' is a token too
+
+            while (tokenEnd < end && !isspace((unsigned char)*tokenEnd) && !strchr("{;()", *tokenEnd))
+                tokenEnd++;
+
+            string token(p, tokenEnd);
+            p = tokenEnd;
+
+            if (token == "1-0" || token == "0-1" || token == "1/2-1/2" || token == "*")
+                break;
+
+            // Strip the move number, "12." or "12...", but not the leading
+            // zero of "0-0" castling, and skip NAGs.
+            size_t n = token.find_first_not_of("0123456789");
+
+            if (n == string::npos || token[n] == '.')
+                token.erase(0, token.find_first_not_of(".", n));
+
+            if (token.empty() || token[0] == '$')
+                continue;
+
+            Move m = move_from_san(pos, token);
+
+            if (!m)
+                return false;
+
+            RunEntry e = { book_key(pos), polyglot_move(m), { 1, 0 } };
+            e.stats.score = pos.side_to_move() == WHITE ? whiteScore : 2 - whiteScore;
+            gameMoves.push_back(e);
+            pos.do_move(m, states[ply++]);
+        }
+    }
+
+    for (size_t i = 0; i < gameMoves.size(); i++)
+        add_move(bb, gameMoves[i]);
+
+    return true;
+  }
+
+  // book_worker() parses the chunks of the PGN file until all are taken. A chunk
+  // holds the games starting in its range of bytes.
+  long book_worker(BookBuilder* bb) {
+
+    std::vector<StateInfo> states(bb->maxPly);
+    uint64_t games = 0, skipped = 0;
+
+    while (true)
+    {
+        lock_grab(bb->lock);
+        size_t begin = bb->next;
+        bb->next += ChunkSize;
+        lock_release(bb->lock);
+
+        if (begin >= bb->pgnSize)
+            break;
+
+        size_t end = std::min(begin + ChunkSize, bb->pgnSize);
+
+        for (size_t g = game_start(bb, begin), next; g < end; g = next)
+        {
+            next = game_start(bb, g + 1);
+
+            if (parse_game(bb, bb->pgn + g, bb->pgn + next, states))
+                games++;
+            else
+                skipped++;
+        }
+    }
+
+    lock_grab(bb->lock);
+    bb->games += games;
+    bb->skipped += skipped;
+    lock_release(bb->lock);
+
+    return 0;
+  }
+
+  // write_position() drops the moves of a position played in less than minGames
+  // games or never won nor drawn, weighs the others by their score, scaled to fit
+  // 16 bits, and appends them to the book with the best first.
+  void write_position(ofstream& book, std::vector<RunEntry>& moves, uint32_t minGames,
+                      uint64_t* entries, uint64_t* positions) {
+
+    std::vector<std::pair<uint32_t, uint16_t> > weighted;
+    uint32_t maxScore = 65535;
+
+    for (size_t i = 0; i < moves.size(); i++)
+        maxScore = max(maxScore, moves[i].stats.score);
+
+    for (size_t i = 0; i < moves.size(); i++)
+        if (moves[i].stats.games >= minGames && moves[i].stats.score)
+        {
+            uint32_t w = uint32_t(uint64_t(moves[i].stats.score) * 65535 / maxScore);
+            weighted.push_back(std::make_pair(max(w, 1U), moves[i].move));
+        }
+
+    std::stable_sort(weighted.begin(), weighted.end(), std::greater<std::pair<uint32_t, uint16_t> >());
+
+    for (size_t i = 0; i < weighted.size(); i++)
+    {
+        unsigned char e[16] = { 0 }; // Key, move, weight and learn, big-endian
+
+        for (int b = 0; b < 8; b++)
+            e[b] = (unsigned char)(moves[0].key >> (56 - 8 * b));
+
+        e[8]  = (unsigned char)(weighted[i].second >> 8);
+        e[9]  = (unsigned char)(weighted[i].second);
+        e[10] = (unsigned char)(weighted[i].first >> 8);
+        e[11] = (unsigned char)(weighted[i].first);
+        book.write((const char*)e, sizeof(e));
+    }
+
+    *entries += weighted.size();
+    *positions += !weighted.empty();
+    moves.clear();
+  }
+
+  // merge_shard() merges the runs of a shard with the entries still in memory,
+  // and writes the positions to the book in key order.
+  void merge_shard(Shard& sh, ofstream& book, uint32_t minGames,
+                   uint64_t* entries, uint64_t* positions) {
+
+    std::vector<ifstream*> runs;
+    std::vector<RunEntry> heads(sh.runs.size()), moves;
+    std::vector<bool> valid(sh.runs.size());
+    std::vector<RunEntry> last = sorted_entries(sh);
+    size_t next = 0;
+
+    for (size_t i = 0; i < sh.runs.size(); i++)
+    {
+        runs.push_back(new ifstream(sh.runs[i].c_str(), ios::in | ios::binary));
+        valid[i] = read_run_entry(*runs[i], heads[i]);
+    }
+
+    while (true)
+    {
+        // Find the smallest key and move among the runs and the entries in memory
+        bool found = next < last.size();
+        RunEntry e = found ? last[next] : RunEntry();
+
+        for (size_t i = 0; i < runs.size(); i++)
+            if (valid[i] && (!found || heads[i] < e))
+            {
+                e = heads[i];
+                found = true;
+            }
+
+        if (!found)
+            break;
+
+        e.stats.games = e.stats.score = 0;
+
+        if (next < last.size() && last[next].same_move(e))
+        {
+            e.stats = last[next].stats;
+            next++;
+        }
+
+        for (size_t i = 0; i < runs.size(); i++)
+            if (valid[i] && heads[i].same_move(e))
+            {
+                e.stats.games += heads[i].stats.games;
+                e.stats.score += heads[i].stats.score;
+                valid[i] = read_run_entry(*runs[i], heads[i]);
+            }
+
+        if (!moves.empty() && moves[0].key != e.key)
+            write_position(book, moves, minGames, entries, positions);
+
+        moves.push_back(e);
+    }
+
+    if (!moves.empty())
+        write_position(book, moves, minGames, entries, positions);
+
+    for (size_t i = 0; i < runs.size(); i++)
+    {
+        delete runs[i];
+        remove(sh.runs[i].c_str());
+    }
+  }
+
+} // namespace
+
+
+/// make_book() is called by the "makebook <pgn file> [book file] [plies] [min
+/// games] [threads] [memory MB]" command. It builds a Polyglot book with the
+/// moves of the first plies (default 30) of the games, played in at least min
+/// games (default 3). The PGN file is parsed in parallel, by chunks of games,
+/// with the given number of threads (default "Threads"). The statistics are
+/// spilled to disk when they exceed the given memory (default "Hash").
+
+void make_book(istream& is) {
+
+  string pgnFile, bookFile = "book.bin";
+  int maxPly = 30, minGames = 3, threads = Options["Threads"], mb = Options["Hash"];
+  uint64_t size, entries = 0, positions = 0;
+
+  if (!(is >> pgnFile))
+  {
+      cerr << "Usage: makebook <pgn file> [book file] [plies] [min games] [threads] [memory MB]" << endl;
+      return;
+  }
+
+  is >> bookFile >> maxPly >> minGames >> threads >> mb;
+
+  const char* pgn = (const char*)map_file(pgnFile, &size);
+
+  if (!pgn)
+  {
+      cerr << "Unable to open file " << pgnFile << endl;
+      return;
+  }
+
+  BookBuilder* bb = new BookBuilder();
+  bb->pgn = pgn;
+  bb->pgnSize = size_t(size);
+  bb->next = 0;
+  bb->bookFile = bookFile;
+  bb->maxPly = max(maxPly, 1);
+  bb->games = bb->skipped = 0;
+
+  // The largest power of two of slots fitting in the memory share of a shard
+  size_t shardBytes = size_t(max(mb, 1)) * 1024 * 1024 / ShardCnt;
+
+  for (bb->maxShardSlots = 1024; bb->maxShardSlots * 2 * sizeof(RunEntry) <= shardBytes; )
+      bb->maxShardSlots *= 2;
+
+  lock_init(bb->lock);
+
+  for (int i = 0; i < ShardCnt; i++)
+  {
+      lock_init(bb->shards[i].lock);
+      bb->shards[i].table.resize(1024);
+      bb->shards[i].count = 0;
+  }
+
+  std::vector<NativeHandle> handles(max(threads, 1));
+  Time::point elapsed = Time::now();
+
+  for (size_t i = 1; i < handles.size(); i++)
+      if (!thread_create(handles[i], book_worker, bb))
+      {
+          cerr << "Failed to create a book thread" << endl;
+          exit(EXIT_FAILURE);
+      }
+
+  book_worker(bb);
+
+  for (size_t i = 1; i < handles.size(); i++)
+      thread_join(handles[i]);
+
+  Time::point parseTime = max(Time::now() - elapsed, Time::point(1));
+
+  sync_cout << "info string " << bb->games << " games (" << bb->skipped << " skipped) parsed in "
+            << parseTime << " ms, " << bb->games * 1000 / parseTime << " games/s" << sync_endl;
+
+  unmap_file(pgn, size);
+
+  // Write to a new file, the old one may still be mapped by the search
+  string tmpFile = bookFile + ".tmp";
+  ofstream book(tmpFile.c_str(), ios::out | ios::binary);
+
+  for (int i = 0; i < ShardCnt; i++)
+  {
+      merge_shard(bb->shards[i], book, uint32_t(max(minGames, 1)), &entries, &positions);
+      lock_destroy(bb->shards[i].lock);
+  }
+
+  lock_destroy(bb->lock);
+  delete bb;
+  book.close();
+
+  if (book)
+      remove(bookFile.c_str());
+
+  if (!book || rename(tmpFile.c_str(), bookFile.c_str()))
+  {
+      cerr << "Unable to write file " << bookFile << endl;
+      return;
+  }
+
+  sync_cout << "info string " << entries << " moves of " << positions << " positions written to "
+            << bookFile << " in " << Time::now() - elapsed << " ms" << sync_endl;
+}
@@ -20,26 +20,36 @@
 #if !defined(BOOK_H_INCLUDED)
 #define BOOK_H_INCLUDED
 
-#include <fstream>
 #include <string>
+#include <vector>
 
 #include "position.h"
 #include "rkiss.h"
 
-class PolyglotBook : private std::ifstream {
+/// PolyglotBook keeps the book file memory mapped until a different file is
+/// probed. A sparse index with the key of every IndexStride-th entry is kept
+/// in memory, so that a probe binary searches the index and then touches only
+/// a small range of the mapped file.
+
+class PolyglotBook {
 public:
   PolyglotBook();
  ~PolyglotBook();
   Move probe(const Position& pos, const std::string& fName, bool pickBest);
 
 private:
-  template<typename T> PolyglotBook& operator>>(T& n);
+  static const size_t IndexStride = 4096;
 
   bool open(const char* fName);
-  size_t find_first(uint64_t key);
+  void close();
+  size_t find_first(uint64_t key) const;
 
   RKISS RKiss;
   std::string fileName;
+  const unsigned char* data;
+  uint64_t mappedSize;
+  size_t entryCnt;
+  std::vector<uint64_t> index;
 };
 
 #endif // !defined(BOOK_H_INCLUDED)
@@ -79,9 +79,6 @@ namespace {
     return Position(fen, false, NULL).material_key();
   }
 
-  template<typename M>
-  void delete_endgame(const typename M::value_type& p) { delete p.second; }
-
 } // namespace
 
 
@@ -104,19 +101,63 @@ Endgames::Endgames() {
   add<KBPKN>("KBPKN");
   add<KBPPKB>("KBPPKB");
   add<KRPPKRP>("KRPPKRP");
+
+  build();
 }
 
 Endgames::~Endgames() {
 
-  for_each(m1.begin(), m1.end(), delete_endgame<M1>);
-  for_each(m2.begin(), m2.end(), delete_endgame<M2>);
+  for (size_t i = 0; i < table.size(); i++)
+  {
+      delete table[i].f1;
+      delete table[i].f2;
+  }
 }
 
 template<EndgameType E>
 void Endgames::add(const string& code) {
 
-  map((Endgame<E>*)0)[key(code, WHITE)] = new Endgame<E>(WHITE);
-  map((Endgame<E>*)0)[key(code, BLACK)] = new Endgame<E>(BLACK);
+  for (Color c = WHITE; c <= BLACK; c++)
+  {
+      Entry e = { key(code, c), NULL, NULL };
+      fun(e, (Endgame<E>*)0) = new Endgame<E>(c);
+      table.push_back(e);
+  }
+}
+
+
+/// Endgames::build() turns the list of endgames filled by add() into the hash
+/// table. It looks for the smallest power of two size, and then the lowest
+/// shift of the key, for which no two endgames land on the same slot. Empty
+/// slots have a null key that never matches a position with pieces.
+
+void Endgames::build() {
+
+  std::vector<Entry> list;
+  list.swap(table);
+
+  for (int bits = msb(2 * list.size() - 1) + 1; bits < 64; bits++)
+      for (shift = 0; shift + bits <= 64; shift++)
+      {
+          mask = (1ULL << bits) - 1;
+          table.assign(size_t(1) << bits, Entry());
+
+          size_t i;
+          for (i = 0; i < list.size(); i++)
+          {
+              Entry& e = table[(list[i].key >> shift) & mask];
+
+              if (e.f1 || e.f2)
+                  break;
+
+              e = list[i];
+          }
+
+          if (i == list.size())
+              return;
+      }
+
+  assert(false);
 }
 
 
@@ -20,8 +20,8 @@
 #if !defined(ENDGAME_H_INCLUDED)
 #define ENDGAME_H_INCLUDED
 
-#include <map>
 #include <string>
+#include <vector>
 
 #include "position.h"
 #include "types.h"
@@ -92,29 +92,42 @@ private:
 };
 
 
-/// Endgames class stores in two std::map the pointers to endgame evaluation
-/// and scaling base objects. Then we use polymorphism to invoke the actual
-/// endgame function calling its operator() that is virtual.
+/// Endgames class stores the pointers to endgame evaluation and scaling base
+/// objects in a flat table indexed by a perfect hash of the material key: the
+/// table size and the key bits used are chosen at construction so that every
+/// endgame has its own slot, and a probe is a single lookup. Then we use
+/// polymorphism to invoke the actual endgame function calling its operator()
+/// that is virtual. The table is immutable once built.
 
 class Endgames {
 
-  typedef std::map<Key, EndgameBase<eg_fun<0>::type>*> M1;
-  typedef std::map<Key, EndgameBase<eg_fun<1>::type>*> M2;
+  typedef EndgameBase<eg_fun<0>::type>* F1;
+  typedef EndgameBase<eg_fun<1>::type>* F2;
 
-  M1 m1;
-  M2 m2;
+  struct Entry {
+    Key key;
+    F1 f1;
+    F2 f2;
+  };
 
-  M1& map(M1::mapped_type) { return m1; }
-  M2& map(M2::mapped_type) { return m2; }
+  std::vector<Entry> table;
+  int shift;
+  Key mask;
+
+  static F1& fun(Entry& e, F1) { return e.f1; }
+  static F2& fun(Entry& e, F2) { return e.f2; }
 
   template<EndgameType E> void add(const std::string& code);
+  void build();
 
 public:
   Endgames();
   ~Endgames();
 
-  template<typename T> T probe(Key key, T& eg)
-  { return eg = map(eg).count(key) ? map(eg)[key] : NULL; }
+  template<typename T> T probe(Key key, T& eg) {
+    Entry& e = table[(key >> shift) & mask];
+    return eg = e.key == key ? fun(e, eg) : NULL;
+  }
 };
 
 #endif // !defined(ENDGAME_H_INCLUDED)
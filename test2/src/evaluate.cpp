@@ -74,9 +74,7 @@ namespace {
   // Evaluation grain size, must be a power of 2
   const int GrainSize = 8;
 
-  // Evaluation weights, initialized from UCI options
   enum { Mobility, PassedPawns, Space, KingDangerUs, KingDangerThem };
-  Score Weights[6];
 
   typedef Value V;
   #define S(mg, eg) make_score(mg, eg)
@@ -86,11 +84,24 @@ namespace {
   // the evaluation weights while keeping the default values of the UCI
   // parameters at 100, which looks prettier.
   //
-  // Values modified by Joona Kiiski
+  // Values modified by Joona Kiiski. They are spelled out instead of using
+  // S() because make_score() is a function call, and in C++03 that would make
+  // the table dynamically initialized, so not a compile time constant.
   const Score WeightsInternal[] = {
-      S(252, 344), S(216, 266), S(46, 0), S(247, 0), S(259, 0)
+      Score((252 << 16) + 344), Score((216 << 16) + 266), Score(46 << 16),
+      Score(247 << 16), Score(259 << 16)
   };
 
+  // Evaluation weights, initialized from UCI options. When compiled with
+  // FIXED_EVAL_WEIGHTS the UCI parameters are not available and are considered
+  // at their default value of 100, so that the weights are just the internal
+  // ones and the compiler can fold them into the apply_weight() multiplies.
+#if defined(FIXED_EVAL_WEIGHTS)
+  const Score* const Weights = WeightsInternal;
+#else
+  Score Weights[6];
+#endif
+
   // MobilityBonus[PieceType][attacked] contains mobility bonuses for middle and
   // end game, indexed by piece type and number of attacked squares not occupied
   // by friendly pieces.
@@ -233,9 +244,18 @@ namespace {
     PASSED = 12, UNSTOPPABLE = 13, SPACE = 14, TOTAL = 15
   };
 
+  // Lazy evaluation margin, initialized from UCI options, used by the exits
+  // both before and after the pawn evaluation. Zero disables lazy exits.
+  Value LazyMargin;
+
   // Function prototypes
-  template<bool Trace>
-  Value do_evaluate(const Position& pos, Value& margin);
+  template<bool Trace, bool Lazy>
+  Value do_evaluate(const Position& pos, Value& margin, Value alpha, Value beta, bool& lazy);
+
+  template<bool Lazy>
+  Value cached_evaluate(const Position& pos, Value& margin, Value alpha, Value beta, bool& lazy);
+
+  bool lazy_exit(const Position& pos, Score score, Phase ph, Value alpha, Value beta, Value lazyMargin, Value& v);
 
   template<Color Us>
   void init_eval_info(const Position& pos, EvalInfo& ei);
@@ -258,7 +278,9 @@ namespace {
   Score evaluate_unstoppable_pawns(const Position& pos, EvalInfo& ei);
 
   Value interpolate(const Score& v, Phase ph, ScaleFactor sf);
+#if !defined(FIXED_EVAL_WEIGHTS)
   Score weight_option(const std::string& mgOpt, const std::string& egOpt, Score internalWeight);
+#endif
   double to_cp(Value v);
   void trace_add(int idx, Score term_w, Score term_b = SCORE_ZERO);
   void trace_row(const char* name, int idx);
@@ -274,7 +296,57 @@ namespace Eval {
   /// between them based on the remaining material.
 
   Value evaluate(const Position& pos, Value& margin) {
-    return do_evaluate<false>(pos, margin);
+
+    bool lazy;
+    return cached_evaluate<false>(pos, margin, -VALUE_INFINITE, VALUE_INFINITE, lazy);
+  }
+
+
+  /// evaluate() with a window is the staged version. When the score of the
+  /// cheap terms (material, psq tables and then pawns) is already far outside
+  /// the (alpha, beta) window, it returns that score without computing the
+  /// remaining terms and sets 'lazy'. The score is then only good enough for
+  /// the given window, the lazy margin is returned as its uncertainty, and
+  /// neither must be stored as the static evaluation of the position.
+
+  Value evaluate(const Position& pos, Value& margin, Value alpha, Value beta, bool& lazy) {
+    return cached_evaluate<true>(pos, margin, alpha, beta, lazy);
+  }
+
+
+  /// evaluate_batch() computes the static evaluation, from the point of view of
+  /// the side to move, of every position in the given list. It reuses a single
+  /// Position and the main thread's pawn and material tables, and it bypasses
+  /// the eval cache, which would only be polluted by unrelated positions. Each
+  /// value is the one evaluate() returns when the position is the root. A
+  /// position in check has no static evaluation and gets VALUE_NONE. It must
+  /// not be called while searching.
+
+  void evaluate_batch(const std::vector<std::string>& fens, bool chess960, std::vector<Value>& values) {
+
+    Position pos;
+    Value margin;
+    bool lazy;
+    Color rootColor = RootColor;
+    Thread* th = Threads.main_thread();
+
+    values.resize(fens.size());
+
+    for (size_t i = 0; i < fens.size(); i++)
+    {
+        pos.from_fen(fens[i], chess960, th);
+
+        if (pos.in_check())
+        {
+            values[i] = VALUE_NONE;
+            continue;
+        }
+
+        RootColor = pos.side_to_move();
+        values[i] = do_evaluate<false, false>(pos, margin, -VALUE_INFINITE, VALUE_INFINITE, lazy);
+    }
+
+    RootColor = rootColor;
   }
 
 
@@ -283,19 +355,24 @@ namespace Eval {
 
   void init() {
 
+#if !defined(FIXED_EVAL_WEIGHTS)
     Weights[Mobility]       = weight_option("Mobility (Middle Game)", "Mobility (Endgame)", WeightsInternal[Mobility]);
     Weights[PassedPawns]    = weight_option("Passed Pawns (Middle Game)", "Passed Pawns (Endgame)", WeightsInternal[PassedPawns]);
     Weights[Space]          = weight_option("Space", "Space", WeightsInternal[Space]);
     Weights[KingDangerUs]   = weight_option("Cowardice", "Cowardice", WeightsInternal[KingDangerUs]);
     Weights[KingDangerThem] = weight_option("Aggressiveness", "Aggressiveness", WeightsInternal[KingDangerThem]);
+#endif
 
     // King safety is asymmetrical. Our king danger level is weighted by
     // "Cowardice" UCI parameter, instead the opponent one by "Aggressiveness".
     // If running in analysis mode, make sure we use symmetrical king safety. We
-    // do this by replacing both Weights[kingDangerUs] and Weights[kingDangerThem]
-    // by their average.
+    // do this by replacing both the weights by their average.
+    Score kingDangerUs = Weights[KingDangerUs], kingDangerThem = Weights[KingDangerThem];
+
     if (Options["UCI_AnalyseMode"])
-        Weights[KingDangerUs] = Weights[KingDangerThem] = (Weights[KingDangerUs] + Weights[KingDangerThem]) / 2;
+        kingDangerUs = kingDangerThem = (kingDangerUs + kingDangerThem) / 2;
+
+    LazyMargin = Value(int(Options["Lazy Eval Margin"]));
 
     const int MaxSlope = 30;
     const int Peak = 1280;
@@ -304,9 +381,13 @@ namespace Eval {
     {
         t = std::min(Peak, std::min(int(0.4 * i * i), t + MaxSlope));
 
-        KingDangerTable[1][i] = apply_weight(make_score(t, 0), Weights[KingDangerUs]);
-        KingDangerTable[0][i] = apply_weight(make_score(t, 0), Weights[KingDangerThem]);
+        KingDangerTable[1][i] = apply_weight(make_score(t, 0), kingDangerUs);
+        KingDangerTable[0][i] = apply_weight(make_score(t, 0), kingDangerThem);
     }
+
+    // Cached evaluations have been computed with the old weights
+    for (size_t i = 0; i < Threads.size(); i++)
+        Threads[i].evalCache.clear();
   }
 
 
@@ -317,6 +398,7 @@ namespace Eval {
   std::string trace(const Position& pos) {
 
     Value margin;
+    bool lazy;
     std::string totals;
 
     RootColor = pos.side_to_move();
@@ -325,7 +407,7 @@ namespace Eval {
     TraceStream << std::showpoint << std::showpos << std::fixed << std::setprecision(2);
     memset(TracedScores, 0, 2 * 16 * sizeof(Score));
 
-    do_evaluate<true>(pos, margin);
+    do_evaluate<true, false>(pos, margin, -VALUE_INFINITE, VALUE_INFINITE, lazy);
 
     totals = TraceStream.str();
     TraceStream.str("");
@@ -358,10 +440,76 @@ namespace Eval {
 } // namespace Eval
 
 
+/// EvalCache::set_size() resizes the cache to the largest power of 2 number of
+/// entries that fits in the given number of megabytes. A size of zero disables
+/// the cache.
+
+void EvalCache::set_size(size_t mbSize) {
+
+  size_t newSize = mbSize ? 1ULL << msb((mbSize << 20) / sizeof(EvalEntry)) : 0;
+
+  if (newSize != entries.size())
+      std::vector<EvalEntry>(newSize).swap(entries);
+
+  clear();
+}
+
+
+/// EvalCache::clear() erases all the entries, it is called when the evaluation
+/// weights change and must not be called while the owner thread is searching.
+
+void EvalCache::clear() {
+
+  if (!entries.empty())
+      memset(&entries[0], 0, entries.size() * sizeof(EvalEntry));
+}
+
+
 namespace {
 
-template<bool Trace>
-Value do_evaluate(const Position& pos, Value& margin) {
+// cached_evaluate() looks up the evaluation cache before calling do_evaluate().
+// Results of a lazy evaluation are not exact so are not stored, and neither
+// are the ones that do not fit in the 16 bit fields of an entry, as the values
+// of some specialized endgame functions.
+
+template<bool Lazy>
+Value cached_evaluate(const Position& pos, Value& margin, Value alpha, Value beta, bool& lazy) {
+
+  // Evaluation depends on RootColor because of the asymmetric king safety,
+  // so when black is at the root we look up the complemented key instead.
+  Key key = Eval::RootColor == WHITE ? pos.key() : ~pos.key();
+  Thread* th = pos.this_thread();
+  EvalEntry* e = th->evalCache.probe(key);
+
+  if (!e)
+      return do_evaluate<false, Lazy>(pos, margin, alpha, beta, lazy);
+
+  STAT_INC(th, EVAL_CACHE_PROBES);
+
+  if (e->key == key >> 32)
+  {
+      STAT_INC(th, EVAL_CACHE_HITS);
+      lazy = false;
+      margin = Value(e->margin);
+      return Value(e->value);
+  }
+
+  Value v = do_evaluate<false, Lazy>(pos, margin, alpha, beta, lazy);
+
+  if (   !lazy
+      && abs(v) <= SHRT_MAX
+      && abs(margin) <= SHRT_MAX)
+  {
+      e->key = key >> 32;
+      e->value = int16_t(v);
+      e->margin = int16_t(margin);
+  }
+  return v;
+}
+
+
+template<bool Trace, bool Lazy>
+Value do_evaluate(const Position& pos, Value& margin, Value alpha, Value beta, bool& lazy) {
 
   assert(!pos.in_check());
 
@@ -378,6 +526,8 @@ Value do_evaluate(const Position& pos, Value& margin) {
   // Tempo bonus. Score is computed from the point of view of white.
   score = pos.psq_score() + (pos.side_to_move() == WHITE ? Tempo : -Tempo);
 
+  lazy = false;
+
   // Probe the material hash table
   ei.mi = pos.this_thread()->materialTable.probe(pos);
   score += ei.mi->material_value();
@@ -390,10 +540,38 @@ Value do_evaluate(const Position& pos, Value& margin) {
       return ei.mi->evaluate(pos);
   }
 
+  Value v;
+
+  // The lazy score is not scaled, so it can be far off when a scaling function
+  // or factor applies, as in the drawish endgames, or with opposite bishops.
+  bool canExit =   Lazy && LazyMargin
+                && ei.mi->normal_scale_factors()
+                && !pos.opposite_bishops();
+
+  if (canExit)
+  {
+      STAT_INC(pos.this_thread(), LAZY_EVALS);
+
+      if (lazy_exit(pos, score, ei.mi->game_phase(), alpha, beta, LazyMargin, v))
+      {
+          STAT_INC(pos.this_thread(), LAZY_EXITS_MATERIAL);
+          margin = LazyMargin;
+          return lazy = true, v;
+      }
+  }
+
   // Probe the pawn hash table
   ei.pi = pos.this_thread()->pawnTable.probe(pos);
   score += ei.pi->pawns_value();
 
+  if (   canExit
+      && lazy_exit(pos, score, ei.mi->game_phase(), alpha, beta, LazyMargin, v))
+  {
+      STAT_INC(pos.this_thread(), LAZY_EXITS_PAWNS);
+      margin = LazyMargin;
+      return lazy = true, v;
+  }
+
   // Initialize attack and king safety bitboards
   init_eval_info<WHITE>(pos, ei);
   init_eval_info<BLACK>(pos, ei);
@@ -454,7 +632,7 @@ Value do_evaluate(const Position& pos, Value& margin) {
   }
 
   margin = margins[pos.side_to_move()];
-  Value v = interpolate(score, ei.mi->game_phase(), sf);
+  v = interpolate(score, ei.mi->game_phase(), sf);
 
   // In case of tracing add all single evaluation contributions for both white and black
   if (Trace)
@@ -581,7 +759,7 @@ Value do_evaluate(const Position& pos, Value& margin) {
         if (   (Piece == BISHOP || Piece == ROOK || Piece == QUEEN)
             && (PseudoAttacks[Piece][pos.king_square(Them)] & s))
         {
-            b = BetweenBB[s][pos.king_square(Them)] & pos.pieces();
+            b = between_bb(s, pos.king_square(Them)) & pos.pieces();
 
             assert(b);
 
@@ -1166,6 +1344,22 @@ Value do_evaluate(const Position& pos, Value& margin) {
   }
 
 
+  // lazy_exit() returns true if the score computed so far, interpolated with
+  // the normal scale factor, is beyond the window by more than lazyMargin. The
+  // value from the side to move point of view is returned in v.
+
+  bool lazy_exit(const Position& pos, Score score, Phase ph, Value alpha, Value beta, Value lazyMargin, Value& v) {
+
+    v = interpolate(score, ph, SCALE_FACTOR_NORMAL);
+
+    if (pos.side_to_move() == BLACK)
+        v = -v;
+
+    return v - lazyMargin >= beta || v + lazyMargin <= alpha;
+  }
+
+
+#if !defined(FIXED_EVAL_WEIGHTS)
   // weight_option() computes the value of an evaluation weight, by combining
   // two UCI-configurable weights (midgame and endgame) with an internal weight.
 
@@ -1177,6 +1371,7 @@ Value do_evaluate(const Position& pos, Value& margin) {
 
     return apply_weight(make_score(mg, eg), internalWeight);
   }
+#endif
 
 
   // A couple of little helpers used by tracing code, to_cp() converts a value to
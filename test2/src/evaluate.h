@@ -20,17 +20,43 @@
 #if !defined(EVALUATE_H_INCLUDED)
 #define EVALUATE_H_INCLUDED
 
+#include <vector>
+
 #include "types.h"
 
 class Position;
 
+/// EvalCache is a small per-thread hash table where the static evaluations of
+/// the most recently evaluated positions are stored together with their margin,
+/// so that a transposition, a re-search or a sibling node can skip the full
+/// evaluation. An entry is 64 bits wide and uses the high 32 bits of the key
+/// for verification and the low ones for indexing.
+
+struct EvalEntry {
+  uint32_t key;
+  int16_t value, margin;
+};
+
+class EvalCache {
+
+public:
+  void set_size(size_t mbSize);
+  void clear();
+  EvalEntry* probe(Key k) { return entries.empty() ? NULL : &entries[(uint32_t)k & (entries.size() - 1)]; }
+
+private:
+  std::vector<EvalEntry> entries;
+};
+
 namespace Eval {
 
 extern Color RootColor;
 
 extern void init();
 extern Value evaluate(const Position& pos, Value& margin);
+extern Value evaluate(const Position& pos, Value& margin, Value alpha, Value beta, bool& lazy);
 extern std::string trace(const Position& pos);
+extern void evaluate_batch(const std::vector<std::string>& fens, bool chess960, std::vector<Value>& values);
 
 }
 
@@ -0,0 +1,801 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2012 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(KPKTAB_H_INCLUDED)
+#define KPKTAB_H_INCLUDED
+
+#include "types.h"
+
+/// KPK bitbase computed by compute_kpk(), one bit per position with the index
+/// layout described in bitbase.cpp, set when the position is a win for white.
+/// Generated with the "tables kpk" command: do not edit, run "tables" to
+/// verify it.
+
+static const uint32_t KPKBitbase[] = {
+  0xd550fff0, 0xd000d000, 0xd000d000, 0xd000d000, 0xd540ffc0, 0xd000d000, 0xd000d000, 0xd000d000,
+  0xd500ff01, 0xd000d000, 0xd000d000, 0xd000d000, 0xd404fc05, 0xd000d000, 0xd000d000, 0xd000d000,
+  0xd014f035, 0xd000d000, 0xd000d000, 0xd000d000, 0xc054c0f5, 0xd000d000, 0xd000d000, 0xd000d000,
+  0x015403f5, 0xd000d000, 0xd000d000, 0xd000d000, 0x05540ff5, 0xd000d000, 0xd000d000, 0xd000d000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc0ffc0, 0xd000d540, 0xd000d000, 0xd000d000,
+  0xff00ff01, 0xd000d500, 0xd000d000, 0xd000d000, 0xfc04fc05, 0xd000d400, 0xd000d000, 0xd000d000,
+  0xf014f035, 0xd000d000, 0xd000d000, 0xd000d000, 0xc054c0f5, 0xd000c000, 0xd000d000, 0xd000d000,
+  0x015403f5, 0xd0000000, 0xd000d000, 0xd000d000, 0x05540ff5, 0xd0000000, 0xd000d000, 0xd000d000,
+  0xff50ffff, 0xd540ff40, 0xd000d000, 0xd000d000, 0xffc0ffff, 0xd540ffc0, 0xd000d000, 0xd000d000,
+  0xff00fff5, 0xd500ff00, 0xd000d000, 0xd000d000, 0xfc04fff5, 0xd400fc00, 0xd000d000, 0xd000d000,
+  0xf014fff5, 0xd000f000, 0xd000d000, 0xd000d000, 0xc054fff5, 0xc000c000, 0xd000d000, 0xd000d000,
+  0x0154fff5, 0x00000000, 0xd000d000, 0xd000d000, 0x0554fff5, 0x00000000, 0xd000d000, 0xd000d000,
+  0xfff4fff5, 0xff40ff50, 0xf400f540, 0xf400f400, 0xfff4fff5, 0xffc0ffc0, 0xf400f540, 0xf400f400,
+  0xfff4fff5, 0xff00ff00, 0xf400f500, 0xf400f400, 0xfff4fff5, 0xfc00fc00, 0xf400f400, 0xf400f400,
+  0xff54fff5, 0xf000f000, 0xf400f000, 0xf400f400, 0xfd54fff5, 0xc000c000, 0xd000c000, 0xd000d000,
+  0xf554fff5, 0x00000000, 0xd0000000, 0xd000d000, 0xd554fff5, 0x00000000, 0xd0000000, 0xd000d000,
+  0xfff4fff5, 0xff40ff50, 0xfd40ff40, 0xfd00fd00, 0xfff4fff5, 0xffc0fff0, 0xfd40ffc0, 0xfd00fd00,
+  0xfff4fff5, 0xff00fff0, 0xfd00ff00, 0xfd00fd00, 0xfff4fff5, 0xfc00ffd0, 0xfc00fc00, 0xfd00fd00,
+  0xff54fff5, 0xf000ff40, 0xf000f000, 0xf400f400, 0xfd54fff5, 0xc000fd00, 0xc000c000, 0xd000d000,
+  0xf554fff5, 0x0000f400, 0x00000000, 0xd000d000, 0xd554fff5, 0x0000d000, 0x00000000, 0xd000d000,
+  0xfff4fff5, 0xff40ff50, 0xff40ff40, 0xff40ff40, 0xfff4fff5, 0xffd0ffd0, 0xffc0ffc0, 0xff40ff40,
+  0xfff4fff5, 0xff40ff50, 0xff00ff00, 0xff40ff00, 0xfff4fff5, 0xfd00fd50, 0xfc00fc00, 0xfd00fc00,
+  0xff54fff5, 0xf400f540, 0xf000f000, 0xf400f000, 0xfd54fff5, 0xd000d500, 0xc000c000, 0xd000c000,
+  0xf554fff5, 0xd000d400, 0x00000000, 0xd0000000, 0xd554fff5, 0xd000d000, 0x00000000, 0xd0000000,
+  0xff54fff5, 0xff40ff40, 0xff40ff40, 0xff40ff40, 0xff54fff5, 0xff40ff40, 0xff40ff40, 0xffc0ffc0,
+  0xff54fff5, 0xff40ff40, 0xff00ff40, 0xff00ff00, 0xfd54fff5, 0xfd00fd00, 0xfc00fd00, 0xfc00fc00,
+  0xf554fff5, 0xf400f400, 0xf000f400, 0xf000f000, 0xd554fff5, 0xd000d000, 0xc000d000, 0xc000c000,
+  0xd554fff5, 0xd000d000, 0x0000d000, 0x00000000, 0xd554fff5, 0xd000d000, 0x0000d000, 0x00000000,
+  0xfd54fff5, 0xfd00fd00, 0xfd00fd00, 0xff40fd40, 0xfd54fff5, 0xfd00fd00, 0xfd00fd00, 0xffc0fd40,
+  0xfd54fff5, 0xfd00fd00, 0xfd00fd00, 0xff00fd00, 0xfd54fff5, 0xfd00fd00, 0xfd00fd00, 0xfc00fc00,
+  0xf554fff5, 0xf400f400, 0xf400f400, 0xf000f000, 0xd554fff5, 0xd000d000, 0xd000d000, 0xc000c000,
+  0xd554fff5, 0xd000d000, 0xd000d000, 0x00000000, 0xd554fff5, 0xd000d000, 0xd000d000, 0x00000000,
+  0xffd0fff0, 0xff40ff40, 0xff40ff40, 0xff55ff40, 0xffc0ffc0, 0xff40ff40, 0xff40ff40, 0xff55ff40,
+  0xfd01ff03, 0xfd00fd00, 0xfd00fd00, 0xfd55fd00, 0xfc01fc05, 0xfd00fd00, 0xfd00fd00, 0xfd55fd00,
+  0xf011f015, 0xf400f400, 0xf400f400, 0xf555f400, 0xc051c0d5, 0xd000d000, 0xd000d000, 0xd555d000,
+  0x015103d5, 0x40004000, 0x40004000, 0x54004000, 0x05510fd5, 0x40004000, 0x40004000, 0x50004000,
+  0xfff0fff0, 0xffd0ffc0, 0xffd0ffd5, 0xffffffd5, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff03ff03, 0xff41ff00, 0xff41ff55, 0xffffff55, 0xfc01fc05, 0xfd01fc00, 0xfd01fd51, 0xfffffd55,
+  0xf011f015, 0xf400f000, 0xf400f540, 0xfffff555, 0xc051c0d5, 0xd000c000, 0xd000d500, 0xfd55d500,
+  0x015103d5, 0x40000000, 0x40005400, 0xf4005400, 0x05510fd5, 0x40000000, 0x40005000, 0xd0005000,
+  0xfff0ffff, 0xfff0ffe0, 0xfff5fff6, 0xffffffff, 0xffc0ffff, 0xffc0ffc0, 0xffd5ffd9, 0xffffffff,
+  0xff03ffff, 0xff03ff02, 0xff57ff67, 0xffffffff, 0xfc01ffd5, 0xfc01fc00, 0xfd55fd91, 0xffffffff,
+  0xf011ffd5, 0xf000f000, 0xf540f640, 0xffffff55, 0xc051ffd5, 0xc000c000, 0xd500d900, 0xfd55fd00,
+  0x0151ffd5, 0x00000000, 0x54006400, 0xf400f400, 0x0551ffd5, 0x00000000, 0xd000d000, 0xd000d000,
+  0xffd1ffd5, 0xfff0ffc0, 0xfffffff0, 0xffffffff, 0xffd1ffd5, 0xffc0ffc0, 0xffffffc0, 0xffffffff,
+  0xffd1ffd5, 0xff03ff00, 0xffffff03, 0xffffffff, 0xffd1ffd5, 0xfc01fc00, 0xffd5fc01, 0xffffffff,
+  0xffd1ffd5, 0xf000f000, 0xff40f000, 0xffffff55, 0xfd51ffd5, 0xc000c000, 0xfd00c000, 0xfd55fd00,
+  0xf551ffd5, 0x00000000, 0xf4000000, 0xf400f400, 0xd551ffd5, 0x00000000, 0xd0000000, 0xd000d000,
+  0xffd1ffd5, 0xffd0ffc0, 0xfff0fff0, 0xffffffff, 0xffd1ffd5, 0xffc0ffc0, 0xffc0ffc0, 0xffffffff,
+  0xffd1ffd5, 0xff01ffc0, 0xff03ff03, 0xffffffff, 0xffd1ffd5, 0xfc01ffc0, 0xfc05fc01, 0xffffffff,
+  0xffd1ffd5, 0xf000ff40, 0xf000f000, 0xffffff55, 0xfd51ffd5, 0xc000fd00, 0xc000c000, 0xfd55fd00,
+  0xf551ffd5, 0x0000f400, 0x00000000, 0xf400f400, 0xd551ffd5, 0x0000d000, 0x00000000, 0xd000d000,
+  0xffd1ffd5, 0xff40ff40, 0xfff0ff50, 0xfffffff0, 0xffd1ffd5, 0xff40ff40, 0xffc0ff40, 0xffffffc0,
+  0xffd1ffd5, 0xff40ff40, 0xff03ff01, 0xffffff03, 0xffd1ffd5, 0xfd00fd40, 0xfc01fc01, 0xfffffc05,
+  0xffd1ffd5, 0xf400f540, 0xf000f000, 0xfffff015, 0xfd51ffd5, 0xd000d500, 0xc000c000, 0xfd55c000,
+  0xf551ffd5, 0x40005400, 0x00000000, 0xf4000000, 0xd551ffd5, 0x40005000, 0x00000000, 0xd0000000,
+  0xfd51ffd5, 0xfd00fd00, 0xfd50fd00, 0xfff0fff0, 0xfd51ffd5, 0xfd00fd00, 0xfd40fd00, 0xffc0ffc0,
+  0xfd51ffd5, 0xfd00fd00, 0xfd01fd00, 0xff03ff03, 0xfd51ffd5, 0xfd00fd00, 0xfc01fd00, 0xfc05fc01,
+  0xf551ffd5, 0xf400f400, 0xf000f400, 0xf015f000, 0xd551ffd5, 0xd000d000, 0xc000d000, 0xc055c000,
+  0x5551ffd5, 0x40004000, 0x00004000, 0x00000000, 0x5551ffd5, 0x40004000, 0x00004000, 0x00000000,
+  0xf551ffd5, 0xf400f400, 0xf400f400, 0xfff0f550, 0xf551ffd5, 0xf400f400, 0xf400f400, 0xffc0f540,
+  0xf551ffd5, 0xf400f400, 0xf400f400, 0xff03f501, 0xf551ffd5, 0xf400f400, 0xf400f400, 0xfc01f401,
+  0xf551ffd5, 0xf400f400, 0xf400f400, 0xf000f000, 0xd551ffd5, 0xd000d000, 0xd000d000, 0xc000c000,
+  0x5551ffd5, 0x40004000, 0x40004000, 0x00000000, 0x5551ffd5, 0x40004000, 0x40004000, 0x00000000,
+  0xff40ff50, 0xfd00fd00, 0xfd00fd00, 0xfd55fd00, 0xff40ffc0, 0xfd00fd00, 0xfd00fd00, 0xfd55fd00,
+  0xff03ff03, 0xfd01fd01, 0xfd01fd01, 0xfd55fd01, 0xf407fc0f, 0xf401f401, 0xf401f401, 0xf555f401,
+  0xf007f017, 0xf401f401, 0xf401f401, 0xf555f401, 0xc047c057, 0xd001d001, 0xd001d001, 0xd555d001,
+  0x01450357, 0x40004000, 0x40004000, 0x55554000, 0x05450f57, 0x00000000, 0x00000000, 0x50000000,
+  0xff40ff50, 0xff40ff00, 0xff40ff45, 0xffffff55, 0xffc0ffc0, 0xff41ff00, 0xff41ff55, 0xffffff55,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfc0ffc0f, 0xfd07fc03, 0xfd07fd57, 0xfffffd57,
+  0xf007f017, 0xf407f003, 0xf407f547, 0xfffff557, 0xc047c057, 0xd001c001, 0xd001d501, 0xffffd555,
+  0x01450357, 0x40000000, 0x40005400, 0xf5555400, 0x05450f57, 0x00000000, 0x00005000, 0xd0005000,
+  0xff40ff57, 0xff40ff00, 0xff55ff46, 0xffffffff, 0xffc0ffff, 0xffc0ff80, 0xffd5ffd9, 0xffffffff,
+  0xff03ffff, 0xff03ff03, 0xff57ff67, 0xffffffff, 0xfc0fffff, 0xfc0ffc0b, 0xfd5ffd9f, 0xffffffff,
+  0xf007ff57, 0xf007f003, 0xf557f647, 0xffffffff, 0xc047ff57, 0xc001c001, 0xd501d901, 0xfffffd55,
+  0x0145ff57, 0x00000000, 0x54006400, 0xf555f400, 0x0545ff57, 0x00000000, 0x50009000, 0xd000d000,
+  0xff47ff57, 0xff40ff00, 0xff57ff40, 0xffffffff, 0xff47ff57, 0xffc0ff00, 0xffffffc0, 0xffffffff,
+  0xff47ff57, 0xff03ff03, 0xffffff03, 0xffffffff, 0xff47ff57, 0xfc0ffc03, 0xfffffc0f, 0xffffffff,
+  0xff47ff57, 0xf007f003, 0xff57f007, 0xffffffff, 0xff47ff57, 0xc001c001, 0xfd01c001, 0xfffffd55,
+  0xf545ff57, 0x00000000, 0xf4000000, 0xf555f400, 0xd545ff57, 0x00000000, 0xd0000000, 0xd000d000,
+  0xff47ff57, 0xff40ff03, 0xff50ff40, 0xffffffff, 0xff47ff57, 0xff40ff03, 0xffc0ffc0, 0xffffffff,
+  0xff47ff57, 0xff03ff03, 0xff03ff03, 0xffffffff, 0xff47ff57, 0xfc07ff03, 0xfc0ffc0f, 0xffffffff,
+  0xff47ff57, 0xf007ff03, 0xf017f007, 0xffffffff, 0xff47ff57, 0xc001fd01, 0xc001c001, 0xfffffd55,
+  0xf545ff57, 0x0000f400, 0x00000000, 0xf555f400, 0xd545ff57, 0x0000d000, 0x00000000, 0xd000d000,
+  0xff47ff57, 0xfd00fd01, 0xff40fd40, 0xffffff50, 0xff47ff57, 0xfd01fd01, 0xffc0fd40, 0xffffffc0,
+  0xff47ff57, 0xfd01fd01, 0xff03fd01, 0xffffff03, 0xff47ff57, 0xfd01fd01, 0xfc0ffc05, 0xfffffc0f,
+  0xff47ff57, 0xf401f501, 0xf007f005, 0xfffff017, 0xff47ff57, 0xd001d501, 0xc001c001, 0xffffc055,
+  0xf545ff57, 0x40005400, 0x00000000, 0xf5550000, 0xd545ff57, 0x00005000, 0x00000000, 0xd0000000,
+  0xf545ff57, 0xf400f400, 0xf540f400, 0xff50ff40, 0xf545ff57, 0xf400f400, 0xf540f400, 0xffc0ffc0,
+  0xf545ff57, 0xf400f400, 0xf501f400, 0xff03ff03, 0xf545ff57, 0xf400f400, 0xf405f400, 0xfc0ffc0f,
+  0xf545ff57, 0xf400f400, 0xf005f400, 0xf017f007, 0xd545ff57, 0xd000d000, 0xc001d000, 0xc055c001,
+  0x5545ff57, 0x40004000, 0x00004000, 0x01550000, 0x5545ff57, 0x00000000, 0x00000000, 0x00000000,
+  0xd545ff57, 0xd000d000, 0xd000d000, 0xff40d540, 0xd545ff57, 0xd000d000, 0xd000d000, 0xffc0d540,
+  0xd545ff57, 0xd000d000, 0xd000d000, 0xff03d501, 0xd545ff57, 0xd000d000, 0xd000d000, 0xfc0fd405,
+  0xd545ff57, 0xd000d000, 0xd000d000, 0xf007d005, 0xd545ff57, 0xd000d000, 0xd000d000, 0xc001c001,
+  0x5545ff57, 0x40004000, 0x40004000, 0x00000000, 0x5545ff57, 0x00000000, 0x00000000, 0x00000000,
+  0xfd10fd50, 0xf400f400, 0xf400f400, 0xf555f400, 0xfd00fd40, 0xf401f401, 0xf401f401, 0xf555f401,
+  0xfd01ff03, 0xf401f401, 0xf401f401, 0xf555f401, 0xfc0ffc0f, 0xf407f407, 0xf407f407, 0xf557f407,
+  0xd01ff03f, 0xd007d007, 0xd007d007, 0xd557d007, 0xc01fc05f, 0xd007d007, 0xd007d007, 0xd557d007,
+  0x011f015f, 0x40074007, 0x40074007, 0x55574007, 0x05150d5f, 0x00010001, 0x00010001, 0x55550001,
+  0xfd10fd50, 0xf400f400, 0xf400f405, 0xfffff555, 0xfd00fd40, 0xfd01fc00, 0xfd01fd15, 0xfffffd55,
+  0xff03ff03, 0xfd07fc03, 0xfd07fd57, 0xfffffd57, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xf03ff03f, 0xf41ff00f, 0xf41ff55f, 0xfffff55f, 0xc01fc05f, 0xd01fc00f, 0xd01fd51f, 0xffffd55f,
+  0x011f015f, 0x40070007, 0x40075407, 0xffff5557, 0x05150d5f, 0x00010001, 0x00015001, 0xd5555001,
+  0xfd10fd5f, 0xf400f400, 0xf405f406, 0xfffff557, 0xfd00fd5f, 0xfd00fc00, 0xfd55fd19, 0xffffffff,
+  0xff03ffff, 0xff03fe03, 0xff57ff67, 0xffffffff, 0xfc0fffff, 0xfc0ffc0f, 0xfd5ffd9f, 0xffffffff,
+  0xf03fffff, 0xf03ff02f, 0xf57ff67f, 0xffffffff, 0xc01ffd5f, 0xc01fc00f, 0xd55fd91f, 0xffffffff,
+  0x011ffd5f, 0x00070007, 0x54076407, 0xfffff557, 0x0515fd5f, 0x00010001, 0x50019001, 0xd555d001,
+  0xfd1ffd5f, 0xf400f400, 0xf407f400, 0xfffff557, 0xfd1ffd5f, 0xfd00fc00, 0xfd5ffd00, 0xffffffff,
+  0xfd1ffd5f, 0xff03fc03, 0xffffff03, 0xffffffff, 0xfd1ffd5f, 0xfc0ffc0f, 0xfffffc0f, 0xffffffff,
+  0xfd1ffd5f, 0xf03ff00f, 0xfffff03f, 0xffffffff, 0xfd1ffd5f, 0xc01fc00f, 0xfd5fc01f, 0xffffffff,
+  0xfd1ffd5f, 0x00070007, 0xf4070007, 0xfffff557, 0xd515fd5f, 0x00010001, 0xd0010001, 0xd555d001,
+  0xfd1ffd5f, 0xf400f407, 0xf400f400, 0xfffff557, 0xfd1ffd5f, 0xfd00fc0f, 0xfd40fd00, 0xffffffff,
+  0xfd1ffd5f, 0xfd03fc0f, 0xff03ff03, 0xffffffff, 0xfd1ffd5f, 0xfc0ffc0f, 0xfc0ffc0f, 0xffffffff,
+  0xfd1ffd5f, 0xf01ffc0f, 0xf03ff03f, 0xffffffff, 0xfd1ffd5f, 0xc01ffc0f, 0xc05fc01f, 0xffffffff,
+  0xfd1ffd5f, 0x0007f407, 0x00070007, 0xfffff557, 0xd515fd5f, 0x0001d001, 0x00010001, 0xd555d001,
+  0xfd1ffd5f, 0xf400f405, 0xf400f400, 0xfffff550, 0xfd1ffd5f, 0xf401f405, 0xfd00f500, 0xfffffd40,
+  0xfd1ffd5f, 0xf407f407, 0xff03f503, 0xffffff03, 0xfd1ffd5f, 0xf407f407, 0xfc0ff407, 0xfffffc0f,
+  0xfd1ffd5f, 0xf407f407, 0xf03ff017, 0xfffff03f, 0xfd1ffd5f, 0xd007d407, 0xc01fc017, 0xffffc05f,
+  0xfd1ffd5f, 0x40075407, 0x00070007, 0xffff0157, 0xd515fd5f, 0x00015001, 0x00010001, 0xd5550001,
+  0xd515fd5f, 0xd000d000, 0xd400d000, 0xf550f400, 0xd515fd5f, 0xd001d001, 0xd500d001, 0xfd40fd00,
+  0xd515fd5f, 0xd001d001, 0xd501d001, 0xff03ff03, 0xd515fd5f, 0xd001d001, 0xd405d001, 0xfc0ffc0f,
+  0xd515fd5f, 0xd001d001, 0xd015d001, 0xf03ff03f, 0xd515fd5f, 0xd001d001, 0xc015d001, 0xc05fc01f,
+  0x5515fd5f, 0x40014001, 0x00054001, 0x01570007, 0x5515fd5f, 0x00010001, 0x00010001, 0x05550001,
+  0x5515fd5f, 0x40004000, 0x40004000, 0xf4005400, 0x5515fd5f, 0x40004000, 0x40004000, 0xfd005500,
+  0x5515fd5f, 0x40004000, 0x40004000, 0xff035501, 0x5515fd5f, 0x40004000, 0x40004000, 0xfc0f5405,
+  0x5515fd5f, 0x40004000, 0x40004000, 0xf03f5015, 0x5515fd5f, 0x40004000, 0x40004000, 0xc01f4015,
+  0x5515fd5f, 0x40004000, 0x40004000, 0x00070005, 0x5515fd5f, 0x00000000, 0x00000000, 0x00010001,
+  0xd550fff0, 0xd000d000, 0xd000d000, 0xd000d000, 0xd540ffc0, 0xd000d000, 0xd000d000, 0xd000d000,
+  0xd501ff03, 0xd000d000, 0xd000d000, 0xd000d000, 0xd405fc0f, 0xd000d000, 0xd000d000, 0xd000d000,
+  0xd015f03f, 0xd000d000, 0xd000d000, 0xd000d000, 0xc055c0ff, 0xd000d000, 0xd000d000, 0xd000d000,
+  0x015503ff, 0xd000d000, 0xd000d000, 0xd000d000, 0x05550fff, 0xd000d000, 0xd000d000, 0xd000d000,
+  0xff50fff0, 0xd000d540, 0xd000d000, 0xd000d000, 0xffc0ffc0, 0xd000d540, 0xd000d000, 0xd000d000,
+  0xff01ff03, 0xd000d500, 0xd000d000, 0xd000d000, 0xfc05fc0f, 0xd000d400, 0xd000d000, 0xd000d000,
+  0xf015f03f, 0xd000d000, 0xd000d000, 0xd000d000, 0xc055c0ff, 0xd000c000, 0xd000d000, 0xd000d000,
+  0x015503ff, 0xd0000000, 0xd000d000, 0xd000d000, 0x05550fff, 0xd0000000, 0xd000d000, 0xd000d000,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffc0ffff, 0xd540ffc0, 0xd000d000, 0xd000d000,
+  0xff01ffff, 0xd500ff00, 0xd000d000, 0xd000d000, 0xfc05ffff, 0xd400fc00, 0xd000d000, 0xd000d000,
+  0xf015ffff, 0xd000f000, 0xd000d000, 0xd000d000, 0xc055ffff, 0xc000c000, 0xd000d000, 0xd000d000,
+  0x0155ffff, 0x00000000, 0xd000d000, 0xd000d000, 0x0555ffff, 0x00000000, 0xd000d000, 0xd000d000,
+  0xffffffff, 0xff40ff50, 0xf400f540, 0xf400f400, 0xffffffff, 0xffc0ffc0, 0xf400f540, 0xf400f400,
+  0xfff5ffff, 0xff00ff00, 0xf400f500, 0xf400f400, 0xffd5ffff, 0xfc00fc00, 0xf400f400, 0xf400f400,
+  0xff55ffff, 0xf000f000, 0xf400f000, 0xf400f400, 0xfd55ffff, 0xc000c000, 0xd000c000, 0xd000d000,
+  0xf555ffff, 0x00000000, 0xd0000000, 0xd000d000, 0xd555ffff, 0x00000000, 0xd0000000, 0xd000d000,
+  0xfff5ffff, 0xff40ff54, 0xfd40ff40, 0xfd00fd00, 0xfff5ffff, 0xffc0fff4, 0xfd40ffc0, 0xfd00fd00,
+  0xffd5ffff, 0xff00ffd0, 0xfd00ff00, 0xfd00fd00, 0xff55ffff, 0xfc00ff40, 0xfc00fc00, 0xfd00fd00,
+  0xfd55ffff, 0xf000fd00, 0xf000f000, 0xf400f400, 0xf555ffff, 0xc000f400, 0xc000c000, 0xd000d000,
+  0xd555ffff, 0x0000d000, 0x00000000, 0xd000d000, 0xd555ffff, 0x0000d000, 0x00000000, 0xd000d000,
+  0xffd5ffff, 0xff40ff50, 0xff40ff40, 0xff40ff40, 0xffd5ffff, 0xffd0ffd0, 0xffc0ffc0, 0xff40ff40,
+  0xffd5ffff, 0xff40ff50, 0xff00ff00, 0xff40ff00, 0xff55ffff, 0xfd00fd40, 0xfc00fc00, 0xfd00fc00,
+  0xfd55ffff, 0xf400f500, 0xf000f000, 0xf400f000, 0xf555ffff, 0xd000d400, 0xc000c000, 0xd000c000,
+  0xd555ffff, 0xd000d000, 0x00000000, 0xd0000000, 0xd555ffff, 0xd000d000, 0x00000000, 0xd0000000,
+  0xff55ffff, 0xff40ff40, 0xff40ff40, 0xff40ff40, 0xff55ffff, 0xff40ff40, 0xff40ff40, 0xffc0ffc0,
+  0xff55ffff, 0xff40ff40, 0xff00ff40, 0xff00ff00, 0xfd55ffff, 0xfd00fd00, 0xfc00fd00, 0xfc00fc00,
+  0xf555ffff, 0xf400f400, 0xf000f400, 0xf000f000, 0xd555ffff, 0xd000d000, 0xc000d000, 0xc000c000,
+  0xd555ffff, 0xd000d000, 0x0000d000, 0x00000000, 0xd555ffff, 0xd000d000, 0x0000d000, 0x00000000,
+  0xfd55ffff, 0xfd00fd00, 0xfd00fd00, 0xff40fd40, 0xfd55ffff, 0xfd00fd00, 0xfd00fd00, 0xffc0fd40,
+  0xfd55ffff, 0xfd00fd00, 0xfd00fd00, 0xff00fd00, 0xfd55ffff, 0xfd00fd00, 0xfd00fd00, 0xfc00fc00,
+  0xf555ffff, 0xf400f400, 0xf400f400, 0xf000f000, 0xd555ffff, 0xd000d000, 0xd000d000, 0xc000c000,
+  0xd555ffff, 0xd000d000, 0xd000d000, 0x00000000, 0xd555ffff, 0xd000d000, 0xd000d000, 0x00000000,
+  0xff50fff0, 0xfd00fd40, 0xfd00fd00, 0xfd00fd00, 0xff40ffc0, 0xfd00fd40, 0xfd00fd00, 0xfd00fd00,
+  0xff01ff03, 0xfd00fd40, 0xfd00fd00, 0xfd00fd00, 0xf405fc0f, 0xf400f400, 0xf400f400, 0xf400f400,
+  0xf015f03f, 0xf400f400, 0xf400f400, 0xf400f400, 0xc055c0ff, 0xd000d000, 0xd000d000, 0xd000d000,
+  0x015503ff, 0x40004000, 0x40004000, 0x40004000, 0x05550fff, 0x40004000, 0x40004000, 0x40004000,
+  0xfff0fff0, 0xff40ffd0, 0xff40ff40, 0xff40ff40, 0xffc0ffc0, 0xff40ffc0, 0xff40ff40, 0xff40ff40,
+  0xff03ff03, 0xfd00fd01, 0xfd00fd00, 0xfd00fd00, 0xfc05fc0f, 0xfd00fc01, 0xfd00fd00, 0xfd00fd00,
+  0xf015f03f, 0xf400f000, 0xf400f400, 0xf400f400, 0xc055c0ff, 0xd000c000, 0xd000d000, 0xd000d000,
+  0x015503ff, 0x40000000, 0x40004000, 0x40004000, 0x05550fff, 0x40000000, 0x40004000, 0x40004000,
+  0xfff0ffff, 0xffc0fff0, 0xffd5ffd0, 0xffd5ffd0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xff03ffff, 0xff00ff03, 0xff55ff41, 0xff55ff41, 0xfc05ffff, 0xfc00fc01, 0xfd51fd01, 0xfd55fd01,
+  0xf015ffff, 0xf000f000, 0xf540f400, 0xf555f400, 0xc055ffff, 0xc000c000, 0xd500d000, 0xd500d000,
+  0x0155ffff, 0x00000000, 0x54004000, 0x54004000, 0x0555ffff, 0x00000000, 0x50004000, 0x50004000,
+  0xffffffff, 0xffe0fff0, 0xfff6fff0, 0xfffffff5, 0xffffffff, 0xffc0ffc0, 0xffd9ffc0, 0xffffffd5,
+  0xffffffff, 0xff02ff03, 0xff67ff03, 0xffffff57, 0xffd5ffff, 0xfc00fc01, 0xfd91fc01, 0xfffffd55,
+  0xff55ffff, 0xf000f000, 0xf640f000, 0xff55f540, 0xfd55ffff, 0xc000c000, 0xd900c000, 0xfd00d500,
+  0xf555ffff, 0x00000000, 0x64000000, 0xf4005400, 0xd555ffff, 0x00000000, 0xd0000000, 0xd000d000,
+  0xffd5ffff, 0xffc0ffd1, 0xfff0fff0, 0xffffffff, 0xffd5ffff, 0xffc0ffd1, 0xffc0ffc0, 0xffffffff,
+  0xffd5ffff, 0xff00ffd1, 0xff03ff03, 0xffffffff, 0xff55ffff, 0xfc00ff41, 0xfc01fc01, 0xffffffd5,
+  0xfd55ffff, 0xf000fd00, 0xf000f000, 0xff55ff40, 0xf555ffff, 0xc000f400, 0xc000c000, 0xfd00fd00,
+  0xd555ffff, 0x0000d000, 0x00000000, 0xf400f400, 0x5555ffff, 0x00004000, 0x00000000, 0xd000d000,
+  0xff55ffff, 0xff40ff40, 0xfff0ffd0, 0xfffffff0, 0xff55ffff, 0xff40ff40, 0xffc0ffc0, 0xffffffc0,
+  0xff55ffff, 0xff40ff40, 0xff03ff01, 0xffffff03, 0xff55ffff, 0xfd00fd40, 0xfc01fc01, 0xfffffc05,
+  0xfd55ffff, 0xf400f500, 0xf000f000, 0xff55f000, 0xf555ffff, 0xd000d400, 0xc000c000, 0xfd00c000,
+  0xd555ffff, 0x40005000, 0x00000000, 0xf4000000, 0x5555ffff, 0x40004000, 0x00000000, 0xd0000000,
+  0xfd55ffff, 0xfd00fd00, 0xff50fd40, 0xfff0fff0, 0xfd55ffff, 0xfd00fd00, 0xff40fd40, 0xffc0ffc0,
+  0xfd55ffff, 0xfd00fd00, 0xff01fd40, 0xff03ff03, 0xfd55ffff, 0xfd00fd00, 0xfc01fd00, 0xfc05fc01,
+  0xf555ffff, 0xf400f400, 0xf000f400, 0xf015f000, 0xd555ffff, 0xd000d000, 0xc000d000, 0xc000c000,
+  0x5555ffff, 0x40004000, 0x00004000, 0x00000000, 0x5555ffff, 0x40004000, 0x00004000, 0x00000000,
+  0xf555ffff, 0xf400f400, 0xf500f400, 0xfff0fd50, 0xf555ffff, 0xf400f400, 0xf500f400, 0xffc0fd40,
+  0xf555ffff, 0xf400f400, 0xf500f400, 0xff03fd01, 0xf555ffff, 0xf400f400, 0xf500f400, 0xfc01fc01,
+  0xf555ffff, 0xf400f400, 0xf400f400, 0xf000f000, 0xd555ffff, 0xd000d000, 0xd000d000, 0xc000c000,
+  0x5555ffff, 0x40004000, 0x40004000, 0x00000000, 0x5555ffff, 0x40004000, 0x40004000, 0x00000000,
+  0xfd50fff0, 0xf400f500, 0xf400f400, 0xf400f400, 0xfd40ffc0, 0xf400f501, 0xf400f400, 0xf400f400,
+  0xfd01ff03, 0xf400f501, 0xf400f400, 0xf400f400, 0xfc05fc0f, 0xf400f501, 0xf400f400, 0xf400f400,
+  0xd015f03f, 0xd000d001, 0xd000d000, 0xd000d000, 0xc055c0ff, 0xd000d001, 0xd000d000, 0xd000d000,
+  0x015503ff, 0x40004000, 0x40004000, 0x40004000, 0x05550fff, 0x00000000, 0x00000000, 0x00000000,
+  0xff50fff0, 0xfd00ff40, 0xfd00fd00, 0xfd00fd00, 0xffc0ffc0, 0xfd00ff40, 0xfd00fd00, 0xfd00fd00,
+  0xff03ff03, 0xfd01ff03, 0xfd01fd01, 0xfd01fd01, 0xfc0ffc0f, 0xf401f407, 0xf401f401, 0xf401f401,
+  0xf017f03f, 0xf401f007, 0xf401f401, 0xf401f401, 0xc055c0ff, 0xd001c001, 0xd001d001, 0xd001d001,
+  0x015503ff, 0x40000000, 0x40004000, 0x40004000, 0x05550fff, 0x00000000, 0x00000000, 0x00000000,
+  0xff50ffff, 0xff00ff40, 0xff45ff40, 0xff55ff40, 0xffc0ffff, 0xff00ffc0, 0xff55ff41, 0xff55ff41,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xfc0fffff, 0xfc03fc0f, 0xfd57fd07, 0xfd57fd07,
+  0xf017ffff, 0xf003f007, 0xf547f407, 0xf557f407, 0xc055ffff, 0xc001c001, 0xd501d001, 0xd555d001,
+  0x0155ffff, 0x00000000, 0x54004000, 0x54004000, 0x0555ffff, 0x00000000, 0x50000000, 0x50000000,
+  0xff57ffff, 0xff00ff40, 0xff46ff40, 0xffffff55, 0xffffffff, 0xff80ffc0, 0xffd9ffc0, 0xffffffd5,
+  0xffffffff, 0xff03ff03, 0xff67ff03, 0xffffff57, 0xffffffff, 0xfc0bfc0f, 0xfd9ffc0f, 0xfffffd5f,
+  0xff57ffff, 0xf003f007, 0xf647f007, 0xfffff557, 0xfd55ffff, 0xc001c001, 0xd901c001, 0xfd55d501,
+  0xf555ffff, 0x00000000, 0x64000000, 0xf4005400, 0xd555ffff, 0x00000000, 0x90000000, 0xd0005000,
+  0xff55ffff, 0xff00ff41, 0xff40ff40, 0xffffff57, 0xff57ffff, 0xff00ff47, 0xffc0ffc0, 0xffffffff,
+  0xff57ffff, 0xff03ff47, 0xff03ff03, 0xffffffff, 0xff57ffff, 0xfc03ff47, 0xfc0ffc0f, 0xffffffff,
+  0xfd57ffff, 0xf003fd07, 0xf007f007, 0xffffff57, 0xf555ffff, 0xc001f401, 0xc001c001, 0xfd55fd01,
+  0xd555ffff, 0x0000d000, 0x00000000, 0xf400f400, 0x5555ffff, 0x00004000, 0x00000000, 0xd000d000,
+  0xfd55ffff, 0xfd00fd01, 0xff40ff40, 0xffffff50, 0xfd55ffff, 0xfd01fd01, 0xffc0ff40, 0xffffffc0,
+  0xfd55ffff, 0xfd01fd01, 0xff03ff03, 0xffffff03, 0xfd55ffff, 0xfd01fd01, 0xfc0ffc07, 0xfffffc0f,
+  0xfd55ffff, 0xf401f501, 0xf007f007, 0xfffff017, 0xf555ffff, 0xd001d401, 0xc001c001, 0xfd55c001,
+  0xd555ffff, 0x40005000, 0x00000000, 0xf4000000, 0x5555ffff, 0x00004000, 0x00000000, 0xd0000000,
+  0xf555ffff, 0xf400f400, 0xfd40f500, 0xff50ff40, 0xf555ffff, 0xf400f400, 0xfd40f501, 0xffc0ffc0,
+  0xf555ffff, 0xf400f400, 0xfd01f501, 0xff03ff03, 0xf555ffff, 0xf400f400, 0xfc05f501, 0xfc0ffc0f,
+  0xf555ffff, 0xf400f400, 0xf005f401, 0xf017f007, 0xd555ffff, 0xd000d000, 0xc001d001, 0xc055c001,
+  0x5555ffff, 0x40004000, 0x00004000, 0x00000000, 0x5555ffff, 0x00000000, 0x00000000, 0x00000000,
+  0xd555ffff, 0xd000d000, 0xd400d000, 0xff40f540, 0xd555ffff, 0xd000d000, 0xd400d000, 0xffc0f540,
+  0xd555ffff, 0xd000d000, 0xd400d000, 0xff03f501, 0xd555ffff, 0xd000d000, 0xd400d000, 0xfc0ff405,
+  0xd555ffff, 0xd000d000, 0xd400d000, 0xf007f005, 0xd555ffff, 0xd000d000, 0xd000d000, 0xc001c001,
+  0x5555ffff, 0x40004000, 0x40004000, 0x00000000, 0x5555ffff, 0x00000000, 0x00000000, 0x00000000,
+  0xf550fff0, 0xd000d400, 0xd000d000, 0xd000d000, 0xf540ffc0, 0xd000d400, 0xd000d000, 0xd000d000,
+  0xf503ff03, 0xd001d405, 0xd001d001, 0xd001d001, 0xf407fc0f, 0xd001d405, 0xd001d001, 0xd001d001,
+  0xf017f03f, 0xd001d405, 0xd001d001, 0xd001d001, 0x4057c0ff, 0x40014005, 0x40014001, 0x40014001,
+  0x015703ff, 0x40014005, 0x40014001, 0x40014001, 0x05550fff, 0x00010001, 0x00010001, 0x00010001,
+  0xf550fff0, 0xf400f400, 0xf400f400, 0xf400f400, 0xfd40ffc0, 0xf401fd00, 0xf401f401, 0xf401f401,
+  0xff03ff03, 0xf401fd01, 0xf401f401, 0xf401f401, 0xfc0ffc0f, 0xf407fc0f, 0xf407f407, 0xf407f407,
+  0xf03ff03f, 0xd007d01f, 0xd007d007, 0xd007d007, 0xc05fc0ff, 0xd007c01f, 0xd007d007, 0xd007d007,
+  0x015703ff, 0x40070007, 0x40074007, 0x40074007, 0x05550fff, 0x00010001, 0x00010001, 0x00010001,
+  0xf550ffff, 0xf400f400, 0xf405f400, 0xf555f400, 0xfd40ffff, 0xfc00fd00, 0xfd15fd01, 0xfd55fd01,
+  0xff03ffff, 0xfc03ff03, 0xfd57fd07, 0xfd57fd07, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xf03fffff, 0xf00ff03f, 0xf55ff41f, 0xf55ff41f, 0xc05fffff, 0xc00fc01f, 0xd51fd01f, 0xd55fd01f,
+  0x0157ffff, 0x00070007, 0x54074007, 0x55574007, 0x0555ffff, 0x00010001, 0x50010001, 0x50010001,
+  0xf557ffff, 0xf400f400, 0xf406f400, 0xf557f405, 0xfd5fffff, 0xfc00fd00, 0xfd19fd00, 0xfffffd55,
+  0xffffffff, 0xfe03ff03, 0xff67ff03, 0xffffff57, 0xffffffff, 0xfc0ffc0f, 0xfd9ffc0f, 0xfffffd5f,
+  0xffffffff, 0xf02ff03f, 0xf67ff03f, 0xfffff57f, 0xfd5fffff, 0xc00fc01f, 0xd91fc01f, 0xffffd55f,
+  0xf557ffff, 0x00070007, 0x64070007, 0xf5575407, 0xd555ffff, 0x00010001, 0x90010001, 0xd0015001,
+  0xf555ffff, 0xf400f401, 0xf400f400, 0xf557f407, 0xfd57ffff, 0xfc00fd07, 0xfd00fd00, 0xfffffd5f,
+  0xfd5fffff, 0xfc03fd1f, 0xff03ff03, 0xffffffff, 0xfd5fffff, 0xfc0ffd1f, 0xfc0ffc0f, 0xffffffff,
+  0xfd5fffff, 0xf00ffd1f, 0xf03ff03f, 0xffffffff, 0xf55fffff, 0xc00ff41f, 0xc01fc01f, 0xfffffd5f,
+  0xd557ffff, 0x0007d007, 0x00070007, 0xf557f407, 0x5555ffff, 0x00014001, 0x00010001, 0xd001d001,
+  0xf555ffff, 0xf400f401, 0xf400f400, 0xf557f400, 0xf557ffff, 0xf401f405, 0xfd00fd00, 0xfffffd40,
+  0xf557ffff, 0xf407f407, 0xff03fd03, 0xffffff03, 0xf557ffff, 0xf407f407, 0xfc0ffc0f, 0xfffffc0f,
+  0xf557ffff, 0xf407f407, 0xf03ff01f, 0xfffff03f, 0xf557ffff, 0xd007d407, 0xc01fc01f, 0xffffc05f,
+  0xd557ffff, 0x40075007, 0x00070007, 0xf5570007, 0x5555ffff, 0x00014001, 0x00010001, 0xd0010001,
+  0xd555ffff, 0xd000d000, 0xf400d400, 0xf550f400, 0xd555ffff, 0xd001d001, 0xf500d401, 0xfd40fd00,
+  0xd555ffff, 0xd001d001, 0xf503d405, 0xff03ff03, 0xd555ffff, 0xd001d001, 0xf407d405, 0xfc0ffc0f,
+  0xd555ffff, 0xd001d001, 0xf017d405, 0xf03ff03f, 0xd555ffff, 0xd001d001, 0xc017d005, 0xc05fc01f,
+  0x5555ffff, 0x40014001, 0x00074005, 0x01570007, 0x5555ffff, 0x00010001, 0x00010001, 0x00010001,
+  0x5555ffff, 0x40004000, 0x50004000, 0xf400d400, 0x5555ffff, 0x40004000, 0x50014000, 0xfd00d500,
+  0x5555ffff, 0x40004000, 0x50014000, 0xff03d501, 0x5555ffff, 0x40004000, 0x50014000, 0xfc0fd405,
+  0x5555ffff, 0x40004000, 0x50014000, 0xf03fd015, 0x5555ffff, 0x40004000, 0x50014000, 0xc01fc015,
+  0x5555ffff, 0x40004000, 0x40014000, 0x00070005, 0x5555ffff, 0x00000000, 0x00010000, 0x00010001,
+  0xfff0fff0, 0xf400f555, 0xf400f400, 0xf400f400, 0xffc0ffc0, 0xf400f555, 0xf400f400, 0xf400f400,
+  0xff03ff03, 0xf400f555, 0xf400f400, 0xf400f400, 0xfc0ffc0f, 0xf400f555, 0xf400f400, 0xf400f400,
+  0xf03ff03f, 0xf400f555, 0xf400f400, 0xf400f400, 0xc0ffc0ff, 0xf400f555, 0xf400f400, 0xf400f400,
+  0x03ff03ff, 0xf400f555, 0xf400f400, 0xf400f400, 0x0fff0fff, 0xf400f555, 0xf400f400, 0xf400f400,
+  0xfff0fff0, 0xf400f550, 0xf400f400, 0xf400f400, 0xffc0ffc0, 0xf400f540, 0xf400f400, 0xf400f400,
+  0xff03ff03, 0xf400f501, 0xf400f400, 0xf400f400, 0xfc0ffc0f, 0xf400f405, 0xf400f400, 0xf400f400,
+  0xf03ff03f, 0xf400f015, 0xf400f400, 0xf400f400, 0xc0ffc0ff, 0xf400c055, 0xf400f400, 0xf400f400,
+  0x03ff03ff, 0xf4000155, 0xf400f400, 0xf400f400, 0x0fff0fff, 0xf4000555, 0xf400f400, 0xf400f400,
+  0xfff0ffff, 0xf540ff50, 0xf400f400, 0xf400f400, 0xffc0ffff, 0xf540ffc0, 0xf400f400, 0xf400f400,
+  0xff03ffff, 0xf500ff01, 0xf400f400, 0xf400f400, 0xfc0fffff, 0xf400fc05, 0xf400f400, 0xf400f400,
+  0xf03fffff, 0xf000f015, 0xf400f400, 0xf400f400, 0xc0ffffff, 0xc000c055, 0xf400f400, 0xf400f400,
+  0x03ffffff, 0x00000155, 0xf400f400, 0xf400f400, 0x0fffffff, 0x04000555, 0xf400f400, 0xf400f400,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffc0ffc0, 0xf400f540, 0xf400f400,
+  0xffffffff, 0xff00ff01, 0xf400f500, 0xf400f400, 0xffffffff, 0xfc00fc05, 0xf400f400, 0xf400f400,
+  0xffffffff, 0xf000f015, 0xf400f000, 0xf400f400, 0xffffffff, 0xc000c055, 0xf400c000, 0xf400f400,
+  0xffffffff, 0x00000155, 0xf4000000, 0xf400f400, 0xffffffff, 0x04000555, 0xf4000400, 0xf400f400,
+  0xffffffff, 0xff50ffff, 0xfd40ff40, 0xfd00fd00, 0xffffffff, 0xffc0ffff, 0xfd40ffc0, 0xfd00fd00,
+  0xffffffff, 0xff00fff5, 0xfd00ff00, 0xfd00fd00, 0xffffffff, 0xfc00ffd5, 0xfc00fc00, 0xfd00fd00,
+  0xffffffff, 0xf000ff55, 0xf000f000, 0xf400f400, 0xffffffff, 0xc000fd55, 0xc000c000, 0xf400f400,
+  0xffffffff, 0x0000f555, 0x00000000, 0xf400f400, 0xffffffff, 0x0400f555, 0x04000400, 0xf400f400,
+  0xffffffff, 0xff54fff5, 0xff40ff40, 0xff40ff40, 0xffffffff, 0xfff4fff5, 0xffc0ffc0, 0xff40ff40,
+  0xffffffff, 0xffd0ffd5, 0xff00ff00, 0xff40ff00, 0xffffffff, 0xff40ff55, 0xfc00fc00, 0xfd00fc00,
+  0xffffffff, 0xfd00fd55, 0xf000f000, 0xf400f000, 0xffffffff, 0xf400f555, 0xc000c000, 0xf400c000,
+  0xffffffff, 0xf400f555, 0x00000000, 0xf4000000, 0xffffffff, 0xf400f555, 0x04000400, 0xf4000400,
+  0xffffffff, 0xff50ffd5, 0xff40ff40, 0xff40ff40, 0xffffffff, 0xffd0ffd5, 0xffc0ffd0, 0xffc0ffc0,
+  0xffffffff, 0xff50ffd5, 0xff00ff40, 0xff00ff00, 0xffffffff, 0xfd40ff55, 0xfc00fd00, 0xfc00fc00,
+  0xffffffff, 0xf500fd55, 0xf000f400, 0xf000f000, 0xffffffff, 0xf400f555, 0xc000f400, 0xc000c000,
+  0xffffffff, 0xf400f555, 0x0000f400, 0x00000000, 0xffffffff, 0xf400f555, 0x0400f400, 0x04000400,
+  0xffffffff, 0xff40ff55, 0xff40ff40, 0xff40ff40, 0xffffffff, 0xff40ff55, 0xff40ff40, 0xffc0ff40,
+  0xffffffff, 0xff40ff55, 0xff40ff40, 0xff00ff00, 0xffffffff, 0xfd00fd55, 0xfd00fd00, 0xfc00fc00,
+  0xffffffff, 0xf400f555, 0xf400f400, 0xf000f000, 0xffffffff, 0xf400f555, 0xf400f400, 0xc000c000,
+  0xffffffff, 0xf400f555, 0xf400f400, 0x00000000, 0xffffffff, 0xf400f555, 0xf400f400, 0x04000400,
+  0xfff0fff0, 0xf400f555, 0xf400f400, 0xf400f400, 0xffc0ffc0, 0xf400f555, 0xf400f400, 0xf400f400,
+  0xff03ff03, 0xf400f555, 0xf400f400, 0xf400f400, 0xfc0ffc0f, 0xf400f555, 0xf400f400, 0xf400f400,
+  0xf03ff03f, 0xd000d555, 0xd000d000, 0xd000d000, 0xc0ffc0ff, 0xd000d555, 0xd000d000, 0xd000d000,
+  0x03ff03ff, 0xd000d555, 0xd000d000, 0xd000d000, 0x0fff0fff, 0xd000d555, 0xd000d000, 0xd000d000,
+  0xfff0fff0, 0xfd40ff50, 0xfd00fd00, 0xfd00fd00, 0xffc0ffc0, 0xfd40ff40, 0xfd00fd00, 0xfd00fd00,
+  0xff03ff03, 0xfd40ff01, 0xfd00fd00, 0xfd00fd00, 0xfc0ffc0f, 0xf400f405, 0xf400f400, 0xf400f400,
+  0xf03ff03f, 0xf400f015, 0xf400f400, 0xf400f400, 0xc0ffc0ff, 0xd000c055, 0xd000d000, 0xd000d000,
+  0x03ff03ff, 0xd0000155, 0xd000d000, 0xd000d000, 0x0fff0fff, 0xd0000555, 0xd000d000, 0xd000d000,
+  0xfff0ffff, 0xffd0fff0, 0xff40ff40, 0xff40ff40, 0xffc0ffff, 0xffc0ffc0, 0xff40ff40, 0xff40ff40,
+  0xff03ffff, 0xfd01ff03, 0xfd00fd00, 0xfd00fd00, 0xfc0fffff, 0xfc01fc05, 0xfd00fd00, 0xfd00fd00,
+  0xf03fffff, 0xf000f015, 0xf400f400, 0xf400f400, 0xc0ffffff, 0xc000c055, 0xd000d000, 0xd000d000,
+  0x03ffffff, 0x00000155, 0xd000d000, 0xd000d000, 0x0fffffff, 0x00000555, 0xd000d000, 0xd000d000,
+  0xffffffff, 0xfff0fff0, 0xffd0ffc0, 0xffd0ffd5, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xffffffff, 0xff03ff03, 0xff41ff00, 0xff41ff55, 0xffffffff, 0xfc01fc05, 0xfd01fc00, 0xfd01fd51,
+  0xffffffff, 0xf000f015, 0xf400f000, 0xf400f540, 0xffffffff, 0xc000c055, 0xd000c000, 0xd000d500,
+  0xffffffff, 0x00000155, 0xd0000000, 0xd000d400, 0xffffffff, 0x00000555, 0xd0000000, 0xd000d000,
+  0xffffffff, 0xfff0ffff, 0xfff0ffe0, 0xfff5fff6, 0xffffffff, 0xffc0ffff, 0xffc0ffc0, 0xffd5ffd9,
+  0xffffffff, 0xff03ffff, 0xff03ff02, 0xff57ff67, 0xffffffff, 0xfc01ffd5, 0xfc01fc00, 0xfd55fd91,
+  0xffffffff, 0xf000ff55, 0xf000f000, 0xf540f640, 0xffffffff, 0xc000fd55, 0xc000c000, 0xd500d900,
+  0xffffffff, 0x0000f555, 0x00000000, 0xf400f400, 0xffffffff, 0x0000d555, 0x00000000, 0xd000d000,
+  0xffffffff, 0xffd1ffd5, 0xfff0ffc0, 0xfffffff0, 0xffffffff, 0xffd1ffd5, 0xffc0ffc0, 0xffffffc0,
+  0xffffffff, 0xffd1ffd5, 0xff03ff00, 0xffffff03, 0xffffffff, 0xff41ff55, 0xfc01fc00, 0xffd5fc01,
+  0xffffffff, 0xfd00fd55, 0xf000f000, 0xff40f000, 0xffffffff, 0xf400f555, 0xc000c000, 0xfd00c000,
+  0xffffffff, 0xd000d555, 0x00000000, 0xf4000000, 0xffffffff, 0xd000d555, 0x00000000, 0xd0000000,
+  0xffffffff, 0xff40ff55, 0xffd0ff40, 0xfff0fff0, 0xffffffff, 0xff40ff55, 0xffc0ff40, 0xffc0ffc0,
+  0xffffffff, 0xff40ff55, 0xff01ff40, 0xff03ff03, 0xffffffff, 0xfd40ff55, 0xfc01fd00, 0xfc05fc01,
+  0xffffffff, 0xf500fd55, 0xf000f400, 0xf000f000, 0xffffffff, 0xd400f555, 0xc000d000, 0xc000c000,
+  0xffffffff, 0xd000d555, 0x0000d000, 0x00000000, 0xffffffff, 0xd000d555, 0x0000d000, 0x00000000,
+  0xffffffff, 0xfd00fd55, 0xfd40fd00, 0xfff0ff50, 0xffffffff, 0xfd00fd55, 0xfd40fd00, 0xffc0ff40,
+  0xffffffff, 0xfd00fd55, 0xfd40fd00, 0xff03ff01, 0xffffffff, 0xfd00fd55, 0xfd00fd00, 0xfc01fc01,
+  0xffffffff, 0xf400f555, 0xf400f400, 0xf000f000, 0xffffffff, 0xd000d555, 0xd000d000, 0xc000c000,
+  0xffffffff, 0xd000d555, 0xd000d000, 0x00000000, 0xffffffff, 0xd000d555, 0xd000d000, 0x00000000,
+  0xfff0fff0, 0xd000d555, 0xd000d000, 0xd000d000, 0xffc0ffc0, 0xd000d555, 0xd000d000, 0xd000d000,
+  0xff03ff03, 0xd000d555, 0xd000d000, 0xd000d000, 0xfc0ffc0f, 0xd000d555, 0xd000d000, 0xd000d000,
+  0xf03ff03f, 0xd000d555, 0xd000d000, 0xd000d000, 0xc0ffc0ff, 0x40005555, 0x40004000, 0x40004000,
+  0x03ff03ff, 0x40005555, 0x40004000, 0x40004000, 0x0fff0fff, 0x40005555, 0x40004000, 0x40004000,
+  0xfff0fff0, 0xf500fd50, 0xf400f400, 0xf400f400, 0xffc0ffc0, 0xf501fd40, 0xf400f400, 0xf400f400,
+  0xff03ff03, 0xf501fd01, 0xf400f400, 0xf400f400, 0xfc0ffc0f, 0xf501fc05, 0xf400f400, 0xf400f400,
+  0xf03ff03f, 0xd001d015, 0xd000d000, 0xd000d000, 0xc0ffc0ff, 0xd001c055, 0xd000d000, 0xd000d000,
+  0x03ff03ff, 0x40000155, 0x40004000, 0x40004000, 0x0fff0fff, 0x40000555, 0x40004000, 0x40004000,
+  0xfff0ffff, 0xff40ff50, 0xfd00fd00, 0xfd00fd00, 0xffc0ffff, 0xff40ffc0, 0xfd00fd00, 0xfd00fd00,
+  0xff03ffff, 0xff03ff03, 0xfd01fd01, 0xfd01fd01, 0xfc0fffff, 0xf407fc0f, 0xf401f401, 0xf401f401,
+  0xf03fffff, 0xf007f017, 0xf401f401, 0xf401f401, 0xc0ffffff, 0xc001c055, 0xd001d001, 0xd001d001,
+  0x03ffffff, 0x00000155, 0x40004000, 0x40004000, 0x0fffffff, 0x00000555, 0x40004000, 0x40004000,
+  0xffffffff, 0xff40ff50, 0xff40ff00, 0xff40ff45, 0xffffffff, 0xffc0ffc0, 0xff41ff00, 0xff41ff55,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xfc0ffc0f, 0xfd07fc03, 0xfd07fd57,
+  0xffffffff, 0xf007f017, 0xf407f003, 0xf407f547, 0xffffffff, 0xc001c055, 0xd001c001, 0xd001d501,
+  0xffffffff, 0x00000155, 0x40000000, 0x40005400, 0xffffffff, 0x00000555, 0x40000000, 0x40005000,
+  0xffffffff, 0xff40ff57, 0xff40ff00, 0xff55ff46, 0xffffffff, 0xffc0ffff, 0xffc0ff80, 0xffd5ffd9,
+  0xffffffff, 0xff03ffff, 0xff03ff03, 0xff57ff67, 0xffffffff, 0xfc0fffff, 0xfc0ffc0b, 0xfd5ffd9f,
+  0xffffffff, 0xf007ff57, 0xf007f003, 0xf557f647, 0xffffffff, 0xc001fd55, 0xc001c001, 0xd501d901,
+  0xffffffff, 0x0000f555, 0x00000000, 0x54006400, 0xffffffff, 0x0000d555, 0x00000000, 0xd000d000,
+  0xffffffff, 0xff41ff55, 0xff40ff00, 0xff57ff40, 0xffffffff, 0xff47ff57, 0xffc0ff00, 0xffffffc0,
+  0xffffffff, 0xff47ff57, 0xff03ff03, 0xffffff03, 0xffffffff, 0xff47ff57, 0xfc0ffc03, 0xfffffc0f,
+  0xffffffff, 0xfd07fd57, 0xf007f003, 0xff57f007, 0xffffffff, 0xf401f555, 0xc001c001, 0xfd01c001,
+  0xffffffff, 0xd000d555, 0x00000000, 0xf4000000, 0xffffffff, 0x40005555, 0x00000000, 0xd0000000,
+  0xffffffff, 0xfd01fd55, 0xff40fd00, 0xff50ff40, 0xffffffff, 0xfd01fd55, 0xff40fd01, 0xffc0ffc0,
+  0xffffffff, 0xfd01fd55, 0xff03fd01, 0xff03ff03, 0xffffffff, 0xfd01fd55, 0xfc07fd01, 0xfc0ffc0f,
+  0xffffffff, 0xf501fd55, 0xf007f401, 0xf017f007, 0xffffffff, 0xd401f555, 0xc001d001, 0xc001c001,
+  0xffffffff, 0x5000d555, 0x00004000, 0x00000000, 0xffffffff, 0x40005555, 0x00004000, 0x00000000,
+  0xffffffff, 0xf400f555, 0xf500f400, 0xff40fd40, 0xffffffff, 0xf400f555, 0xf501f400, 0xffc0fd40,
+  0xffffffff, 0xf400f555, 0xf501f400, 0xff03fd01, 0xffffffff, 0xf400f555, 0xf501f400, 0xfc0ffc05,
+  0xffffffff, 0xf400f555, 0xf401f400, 0xf007f005, 0xffffffff, 0xd000d555, 0xd001d000, 0xc001c001,
+  0xffffffff, 0x40005555, 0x40004000, 0x00000000, 0xffffffff, 0x40005555, 0x40004000, 0x00000000,
+  0xfff0fff0, 0x40005555, 0x40004000, 0x40004000, 0xffc0ffc0, 0x40005555, 0x40004000, 0x40004000,
+  0xff03ff03, 0x40005555, 0x40004000, 0x40004000, 0xfc0ffc0f, 0x40005555, 0x40004000, 0x40004000,
+  0xf03ff03f, 0x40005555, 0x40004000, 0x40004000, 0xc0ffc0ff, 0x40005555, 0x40004000, 0x40004000,
+  0x03ff03ff, 0x00005555, 0x00000000, 0x00000000, 0x0fff0fff, 0x00005555, 0x00000000, 0x00000000,
+  0xfff0fff0, 0xd400f550, 0xd000d000, 0xd000d000, 0xffc0ffc0, 0xd400f540, 0xd000d000, 0xd000d000,
+  0xff03ff03, 0xd405f503, 0xd001d001, 0xd001d001, 0xfc0ffc0f, 0xd405f407, 0xd001d001, 0xd001d001,
+  0xf03ff03f, 0xd405f017, 0xd001d001, 0xd001d001, 0xc0ffc0ff, 0x40054057, 0x40014001, 0x40014001,
+  0x03ff03ff, 0x40050157, 0x40014001, 0x40014001, 0x0fff0fff, 0x00010555, 0x00010001, 0x00010001,
+  0xfff0ffff, 0xf400f550, 0xf400f400, 0xf400f400, 0xffc0ffff, 0xfd00fd40, 0xf401f401, 0xf401f401,
+  0xff03ffff, 0xfd01ff03, 0xf401f401, 0xf401f401, 0xfc0fffff, 0xfc0ffc0f, 0xf407f407, 0xf407f407,
+  0xf03fffff, 0xd01ff03f, 0xd007d007, 0xd007d007, 0xc0ffffff, 0xc01fc05f, 0xd007d007, 0xd007d007,
+  0x03ffffff, 0x00070157, 0x40074007, 0x40074007, 0x0fffffff, 0x00010555, 0x00010001, 0x00010001,
+  0xffffffff, 0xf400f550, 0xf400f400, 0xf400f405, 0xffffffff, 0xfd00fd40, 0xfd01fc00, 0xfd01fd15,
+  0xffffffff, 0xff03ff03, 0xfd07fc03, 0xfd07fd57, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xffffffff, 0xf03ff03f, 0xf41ff00f, 0xf41ff55f, 0xffffffff, 0xc01fc05f, 0xd01fc00f, 0xd01fd51f,
+  0xffffffff, 0x00070157, 0x40070007, 0x40075407, 0xffffffff, 0x00010555, 0x00010001, 0x00015001,
+  0xffffffff, 0xf400f557, 0xf400f400, 0xf405f406, 0xffffffff, 0xfd00fd5f, 0xfd00fc00, 0xfd55fd19,
+  0xffffffff, 0xff03ffff, 0xff03fe03, 0xff57ff67, 0xffffffff, 0xfc0fffff, 0xfc0ffc0f, 0xfd5ffd9f,
+  0xffffffff, 0xf03fffff, 0xf03ff02f, 0xf57ff67f, 0xffffffff, 0xc01ffd5f, 0xc01fc00f, 0xd55fd91f,
+  0xffffffff, 0x0007f557, 0x00070007, 0x54076407, 0xffffffff, 0x0001d555, 0x00010001, 0x50019001,
+  0xffffffff, 0xf401f555, 0xf400f400, 0xf407f400, 0xffffffff, 0xfd07fd57, 0xfd00fc00, 0xfd5ffd00,
+  0xffffffff, 0xfd1ffd5f, 0xff03fc03, 0xffffff03, 0xffffffff, 0xfd1ffd5f, 0xfc0ffc0f, 0xfffffc0f,
+  0xffffffff, 0xfd1ffd5f, 0xf03ff00f, 0xfffff03f, 0xffffffff, 0xf41ff55f, 0xc01fc00f, 0xfd5fc01f,
+  0xffffffff, 0xd007d557, 0x00070007, 0xf4070007, 0xffffffff, 0x40015555, 0x00010001, 0xd0010001,
+  0xffffffff, 0xf401f555, 0xf400f400, 0xf400f400, 0xffffffff, 0xf405f557, 0xfd00f401, 0xfd40fd00,
+  0xffffffff, 0xf407f557, 0xfd03f407, 0xff03ff03, 0xffffffff, 0xf407f557, 0xfc0ff407, 0xfc0ffc0f,
+  0xffffffff, 0xf407f557, 0xf01ff407, 0xf03ff03f, 0xffffffff, 0xd407f557, 0xc01fd007, 0xc05fc01f,
+  0xffffffff, 0x5007d557, 0x00074007, 0x00070007, 0xffffffff, 0x40015555, 0x00010001, 0x00010001,
+  0xffffffff, 0xd000d555, 0xd400d000, 0xf400f400, 0xffffffff, 0xd001d555, 0xd401d001, 0xfd00f500,
+  0xffffffff, 0xd001d555, 0xd405d001, 0xff03f503, 0xffffffff, 0xd001d555, 0xd405d001, 0xfc0ff407,
+  0xffffffff, 0xd001d555, 0xd405d001, 0xf03ff017, 0xffffffff, 0xd001d555, 0xd005d001, 0xc01fc017,
+  0xffffffff, 0x40015555, 0x40054001, 0x00070007, 0xffffffff, 0x00015555, 0x00010001, 0x00010001,
+  0xfff0fff0, 0xfd55ffff, 0xfd00fd00, 0xfd00fd00, 0xffc0ffc0, 0xfd55ffff, 0xfd00fd00, 0xfd00fd00,
+  0xff03ff03, 0xfd55ffff, 0xfd00fd00, 0xfd00fd00, 0xfc0ffc0f, 0xfd55ffff, 0xfd00fd00, 0xfd00fd00,
+  0xf03ff03f, 0xfd55ffff, 0xfd00fd00, 0xfd00fd00, 0xc0ffc0ff, 0xfd55ffff, 0xfd00fd00, 0xfd00fd00,
+  0x03ff03ff, 0xfd55ffff, 0xfd00fd00, 0xfd00fd00, 0x0fff0fff, 0xfd55ffff, 0xfd00fd00, 0xfd00fd00,
+  0xfff0fff0, 0xfd55fff0, 0xfd00fd00, 0xfd00fd00, 0xffc0ffc0, 0xfd55ffc0, 0xfd00fd00, 0xfd00fd00,
+  0xff03ff03, 0xfd55ff03, 0xfd00fd00, 0xfd00fd00, 0xfc0ffc0f, 0xfd55fc0f, 0xfd00fd00, 0xfd00fd00,
+  0xf03ff03f, 0xfd55f03f, 0xfd00fd00, 0xfd00fd00, 0xc0ffc0ff, 0xfd55c0ff, 0xfd00fd00, 0xfd00fd00,
+  0x03ff03ff, 0xfd5503ff, 0xfd00fd00, 0xfd00fd00, 0x0fff0fff, 0xfd550fff, 0xfd00fd00, 0xfd00fd00,
+  0xfff0ffff, 0xfd50fff0, 0xfd00fd00, 0xfd00fd00, 0xffc0ffff, 0xfd40ffc0, 0xfd00fd00, 0xfd00fd00,
+  0xff03ffff, 0xfd01ff03, 0xfd00fd00, 0xfd00fd00, 0xfc0fffff, 0xfc05fc0f, 0xfd00fd00, 0xfd00fd00,
+  0xf03fffff, 0xf015f03f, 0xfd00fd00, 0xfd00fd00, 0xc0ffffff, 0xc055c0ff, 0xfd00fd00, 0xfd00fd00,
+  0x03ffffff, 0x015503ff, 0xfd00fd00, 0xfd00fd00, 0x0fffffff, 0x0d550fff, 0xfd00fd00, 0xfd00fd00,
+  0xffffffff, 0xff50fff0, 0xfd00fd40, 0xfd00fd00, 0xffffffff, 0xffc0ffc0, 0xfd00fd40, 0xfd00fd00,
+  0xffffffff, 0xff01ff03, 0xfd00fd00, 0xfd00fd00, 0xffffffff, 0xfc05fc0f, 0xfd00fc00, 0xfd00fd00,
+  0xffffffff, 0xf015f03f, 0xfd00f000, 0xfd00fd00, 0xffffffff, 0xc055c0ff, 0xfd00c000, 0xfd00fd00,
+  0xffffffff, 0x015503ff, 0xfd000100, 0xfd00fd00, 0xffffffff, 0x0d550fff, 0xfd000d00, 0xfd00fd00,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffc0ffff, 0xfd40ffc0, 0xfd00fd00,
+  0xffffffff, 0xff01ffff, 0xfd00ff00, 0xfd00fd00, 0xffffffff, 0xfc05ffff, 0xfc00fc00, 0xfd00fd00,
+  0xffffffff, 0xf015ffff, 0xf000f000, 0xfd00fd00, 0xffffffff, 0xc055ffff, 0xc000c000, 0xfd00fd00,
+  0xffffffff, 0x0155ffff, 0x01000100, 0xfd00fd00, 0xffffffff, 0x0d55ffff, 0x0d000d00, 0xfd00fd00,
+  0xffffffff, 0xffffffff, 0xff40ff50, 0xff40ff40, 0xffffffff, 0xffffffff, 0xffc0ffc0, 0xff40ff40,
+  0xffffffff, 0xfff5ffff, 0xff00ff00, 0xff40ff00, 0xffffffff, 0xffd5ffff, 0xfc00fc00, 0xfd00fc00,
+  0xffffffff, 0xff55ffff, 0xf000f000, 0xfd00f000, 0xffffffff, 0xfd55ffff, 0xc000c000, 0xfd00c000,
+  0xffffffff, 0xfd55ffff, 0x01000100, 0xfd000100, 0xffffffff, 0xfd55ffff, 0x0d000d00, 0xfd000d00,
+  0xffffffff, 0xfff5ffff, 0xff40ff54, 0xff40ff40, 0xffffffff, 0xfff5ffff, 0xffc0fff4, 0xffc0ffc0,
+  0xffffffff, 0xffd5ffff, 0xff00ffd0, 0xff00ff00, 0xffffffff, 0xff55ffff, 0xfc00ff40, 0xfc00fc00,
+  0xffffffff, 0xfd55ffff, 0xf000fd00, 0xf000f000, 0xffffffff, 0xfd55ffff, 0xc000fd00, 0xc000c000,
+  0xffffffff, 0xfd55ffff, 0x0100fd00, 0x01000100, 0xffffffff, 0xfd55ffff, 0x0d00fd00, 0x0d000d00,
+  0xffffffff, 0xffd5ffff, 0xff40ff50, 0xff40ff40, 0xffffffff, 0xffd5ffff, 0xffd0ffd0, 0xffc0ffc0,
+  0xffffffff, 0xffd5ffff, 0xff40ff50, 0xff00ff00, 0xffffffff, 0xff55ffff, 0xfd00fd40, 0xfc00fc00,
+  0xffffffff, 0xfd55ffff, 0xfd00fd00, 0xf000f000, 0xffffffff, 0xfd55ffff, 0xfd00fd00, 0xc000c000,
+  0xffffffff, 0xfd55ffff, 0xfd00fd00, 0x01000100, 0xffffffff, 0xfd55ffff, 0xfd00fd00, 0x0d000d00,
+  0xfff0fff0, 0xf555ffff, 0xf400f400, 0xf400f400, 0xffc0ffc0, 0xf555ffff, 0xf400f400, 0xf400f400,
+  0xff03ff03, 0xf555ffff, 0xf400f400, 0xf400f400, 0xfc0ffc0f, 0xf555ffff, 0xf400f400, 0xf400f400,
+  0xf03ff03f, 0xf555ffff, 0xf400f400, 0xf400f400, 0xc0ffc0ff, 0xf555ffff, 0xf400f400, 0xf400f400,
+  0x03ff03ff, 0xf555ffff, 0xf400f400, 0xf400f400, 0x0fff0fff, 0xf555ffff, 0xf400f400, 0xf400f400,
+  0xfff0fff0, 0xf555fff0, 0xf400f400, 0xf400f400, 0xffc0ffc0, 0xf555ffc0, 0xf400f400, 0xf400f400,
+  0xff03ff03, 0xf555ff03, 0xf400f400, 0xf400f400, 0xfc0ffc0f, 0xf555fc0f, 0xf400f400, 0xf400f400,
+  0xf03ff03f, 0xf555f03f, 0xf400f400, 0xf400f400, 0xc0ffc0ff, 0xf555c0ff, 0xf400f400, 0xf400f400,
+  0x03ff03ff, 0xf55503ff, 0xf400f400, 0xf400f400, 0x0fff0fff, 0xf5550fff, 0xf400f400, 0xf400f400,
+  0xfff0ffff, 0xff50fff0, 0xfd00fd40, 0xfd00fd00, 0xffc0ffff, 0xff40ffc0, 0xfd00fd40, 0xfd00fd00,
+  0xff03ffff, 0xff01ff03, 0xfd00fd40, 0xfd00fd00, 0xfc0fffff, 0xf405fc0f, 0xf400f400, 0xf400f400,
+  0xf03fffff, 0xf015f03f, 0xf400f400, 0xf400f400, 0xc0ffffff, 0xc055c0ff, 0xf400f400, 0xf400f400,
+  0x03ffffff, 0x015503ff, 0xf400f400, 0xf400f400, 0x0fffffff, 0x05550fff, 0xf400f400, 0xf400f400,
+  0xffffffff, 0xfff0fff0, 0xff40ffd0, 0xff40ff40, 0xffffffff, 0xffc0ffc0, 0xff40ffc0, 0xff40ff40,
+  0xffffffff, 0xff03ff03, 0xfd00fd01, 0xfd00fd00, 0xffffffff, 0xfc05fc0f, 0xfd00fc01, 0xfd00fd00,
+  0xffffffff, 0xf015f03f, 0xf400f000, 0xfd00f500, 0xffffffff, 0xc055c0ff, 0xf400c000, 0xf400f400,
+  0xffffffff, 0x015503ff, 0xf4000000, 0xf400f400, 0xffffffff, 0x05550fff, 0xf4000400, 0xf400f400,
+  0xffffffff, 0xfff0ffff, 0xffc0fff0, 0xffd5ffd0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xffffffff, 0xff03ffff, 0xff00ff03, 0xff55ff41, 0xffffffff, 0xfc05ffff, 0xfc00fc01, 0xff55ff41,
+  0xffffffff, 0xf015ffff, 0xf000f000, 0xfd40fd00, 0xffffffff, 0xc055ffff, 0xc000c000, 0xf500f400,
+  0xffffffff, 0x0155ffff, 0x00000000, 0xf400f400, 0xffffffff, 0x0555ffff, 0x04000400, 0xf400f400,
+  0xffffffff, 0xffffffff, 0xffe0fff0, 0xfffffff0, 0xffffffff, 0xffffffff, 0xffc0ffc0, 0xffffffc0,
+  0xffffffff, 0xffffffff, 0xff02ff03, 0xffffff03, 0xffffffff, 0xffd5ffff, 0xfc00fc01, 0xffd5fc01,
+  0xffffffff, 0xff55ffff, 0xf000f000, 0xff40f000, 0xffffffff, 0xfd55ffff, 0xc000c000, 0xfd00c000,
+  0xffffffff, 0xf555ffff, 0x00000000, 0xf4000000, 0xffffffff, 0xf555ffff, 0x04000400, 0xf4000400,
+  0xffffffff, 0xffd5ffff, 0xffc0ffd1, 0xfff0fff0, 0xffffffff, 0xffd5ffff, 0xffc0ffd1, 0xffc0ffc0,
+  0xffffffff, 0xffd5ffff, 0xff00ffd1, 0xff03ff03, 0xffffffff, 0xff55ffff, 0xfc00ff41, 0xfc05fc01,
+  0xffffffff, 0xfd55ffff, 0xf000fd00, 0xf000f000, 0xffffffff, 0xf555ffff, 0xc000f400, 0xc000c000,
+  0xffffffff, 0xf555ffff, 0x0000f400, 0x00000000, 0xffffffff, 0xf555ffff, 0x0400f400, 0x04000400,
+  0xffffffff, 0xff55ffff, 0xff40ff40, 0xfff0ffd0, 0xffffffff, 0xff55ffff, 0xff40ff40, 0xffc0ffc0,
+  0xffffffff, 0xff55ffff, 0xff40ff40, 0xff03ff01, 0xffffffff, 0xff55ffff, 0xfd00fd40, 0xfc01fc01,
+  0xffffffff, 0xfd55ffff, 0xf400f500, 0xf000f000, 0xffffffff, 0xf555ffff, 0xf400f400, 0xc000c000,
+  0xffffffff, 0xf555ffff, 0xf400f400, 0x00000000, 0xffffffff, 0xf555ffff, 0xf400f400, 0x04000400,
+  0xfff0fff0, 0xd555ffff, 0xd000d000, 0xd000d000, 0xffc0ffc0, 0xd555ffff, 0xd000d000, 0xd000d000,
+  0xff03ff03, 0xd555ffff, 0xd000d000, 0xd000d000, 0xfc0ffc0f, 0xd555ffff, 0xd000d000, 0xd000d000,
+  0xf03ff03f, 0xd555ffff, 0xd000d000, 0xd000d000, 0xc0ffc0ff, 0xd555ffff, 0xd000d000, 0xd000d000,
+  0x03ff03ff, 0xd555ffff, 0xd000d000, 0xd000d000, 0x0fff0fff, 0xd555ffff, 0xd000d000, 0xd000d000,
+  0xfff0fff0, 0xd555fff0, 0xd000d000, 0xd000d000, 0xffc0ffc0, 0xd555ffc0, 0xd000d000, 0xd000d000,
+  0xff03ff03, 0xd555ff03, 0xd000d000, 0xd000d000, 0xfc0ffc0f, 0xd555fc0f, 0xd000d000, 0xd000d000,
+  0xf03ff03f, 0xd555f03f, 0xd000d000, 0xd000d000, 0xc0ffc0ff, 0xd555c0ff, 0xd000d000, 0xd000d000,
+  0x03ff03ff, 0xd55503ff, 0xd000d000, 0xd000d000, 0x0fff0fff, 0xd5550fff, 0xd000d000, 0xd000d000,
+  0xfff0ffff, 0xfd50fff0, 0xf400f500, 0xf400f400, 0xffc0ffff, 0xfd40ffc0, 0xf400f501, 0xf400f400,
+  0xff03ffff, 0xfd01ff03, 0xf400f501, 0xf400f400, 0xfc0fffff, 0xfc05fc0f, 0xf400f501, 0xf400f400,
+  0xf03fffff, 0xd015f03f, 0xd000d001, 0xd000d000, 0xc0ffffff, 0xc055c0ff, 0xd000d001, 0xd000d000,
+  0x03ffffff, 0x015503ff, 0xd000d000, 0xd000d000, 0x0fffffff, 0x05550fff, 0xd000d000, 0xd000d000,
+  0xffffffff, 0xff50fff0, 0xfd00ff40, 0xfd00fd00, 0xffffffff, 0xffc0ffc0, 0xfd00ff40, 0xfd00fd00,
+  0xffffffff, 0xff03ff03, 0xfd01ff03, 0xfd01fd01, 0xffffffff, 0xfc0ffc0f, 0xf401f407, 0xf401f401,
+  0xffffffff, 0xf017f03f, 0xf401f007, 0xf401f401, 0xffffffff, 0xc055c0ff, 0xd001c001, 0xf401d401,
+  0xffffffff, 0x015503ff, 0xd0000000, 0xd000d000, 0xffffffff, 0x05550fff, 0xd0000000, 0xd000d000,
+  0xffffffff, 0xff50ffff, 0xff00ff40, 0xff55ff41, 0xffffffff, 0xffc0ffff, 0xff00ffc0, 0xff55ff41,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xfc0fffff, 0xfc03fc0f, 0xfd57fd07,
+  0xffffffff, 0xf017ffff, 0xf003f007, 0xfd57fd07, 0xffffffff, 0xc055ffff, 0xc001c001, 0xf501f401,
+  0xffffffff, 0x0155ffff, 0x00000000, 0xd400d000, 0xffffffff, 0x0555ffff, 0x00000000, 0xd000d000,
+  0xffffffff, 0xff57ffff, 0xff00ff40, 0xff57ff40, 0xffffffff, 0xffffffff, 0xff80ffc0, 0xffffffc0,
+  0xffffffff, 0xffffffff, 0xff03ff03, 0xffffff03, 0xffffffff, 0xffffffff, 0xfc0bfc0f, 0xfffffc0f,
+  0xffffffff, 0xff57ffff, 0xf003f007, 0xff57f007, 0xffffffff, 0xfd55ffff, 0xc001c001, 0xfd01c001,
+  0xffffffff, 0xf555ffff, 0x00000000, 0xf4000000, 0xffffffff, 0xd555ffff, 0x00000000, 0xd0000000,
+  0xffffffff, 0xff55ffff, 0xff00ff41, 0xff50ff40, 0xffffffff, 0xff57ffff, 0xff00ff47, 0xffc0ffc0,
+  0xffffffff, 0xff57ffff, 0xff03ff47, 0xff03ff03, 0xffffffff, 0xff57ffff, 0xfc03ff47, 0xfc0ffc0f,
+  0xffffffff, 0xfd57ffff, 0xf003fd07, 0xf017f007, 0xffffffff, 0xf555ffff, 0xc001f401, 0xc001c001,
+  0xffffffff, 0xd555ffff, 0x0000d000, 0x00000000, 0xffffffff, 0xd555ffff, 0x0000d000, 0x00000000,
+  0xffffffff, 0xfd55ffff, 0xfd00fd01, 0xff40ff40, 0xffffffff, 0xfd55ffff, 0xfd01fd01, 0xffc0ff40,
+  0xffffffff, 0xfd55ffff, 0xfd01fd01, 0xff03ff03, 0xffffffff, 0xfd55ffff, 0xfd01fd01, 0xfc0ffc07,
+  0xffffffff, 0xfd55ffff, 0xf401f501, 0xf007f007, 0xffffffff, 0xf555ffff, 0xd001d401, 0xc001c001,
+  0xffffffff, 0xd555ffff, 0xd000d000, 0x00000000, 0xffffffff, 0xd555ffff, 0xd000d000, 0x00000000,
+  0xfff0fff0, 0x5555ffff, 0x40004000, 0x40004000, 0xffc0ffc0, 0x5555ffff, 0x40004000, 0x40004000,
+  0xff03ff03, 0x5555ffff, 0x40004000, 0x40004000, 0xfc0ffc0f, 0x5555ffff, 0x40004000, 0x40004000,
+  0xf03ff03f, 0x5555ffff, 0x40004000, 0x40004000, 0xc0ffc0ff, 0x5555ffff, 0x40004000, 0x40004000,
+  0x03ff03ff, 0x5555ffff, 0x40004000, 0x40004000, 0x0fff0fff, 0x5555ffff, 0x40004000, 0x40004000,
+  0xfff0fff0, 0x5555fff0, 0x40004000, 0x40004000, 0xffc0ffc0, 0x5555ffc0, 0x40004000, 0x40004000,
+  0xff03ff03, 0x5555ff03, 0x40004000, 0x40004000, 0xfc0ffc0f, 0x5555fc0f, 0x40004000, 0x40004000,
+  0xf03ff03f, 0x5555f03f, 0x40004000, 0x40004000, 0xc0ffc0ff, 0x5555c0ff, 0x40004000, 0x40004000,
+  0x03ff03ff, 0x555503ff, 0x40004000, 0x40004000, 0x0fff0fff, 0x55550fff, 0x40004000, 0x40004000,
+  0xfff0ffff, 0xf550fff0, 0xd000d400, 0xd000d000, 0xffc0ffff, 0xf540ffc0, 0xd000d400, 0xd000d000,
+  0xff03ffff, 0xf503ff03, 0xd001d405, 0xd001d001, 0xfc0fffff, 0xf407fc0f, 0xd001d405, 0xd001d001,
+  0xf03fffff, 0xf017f03f, 0xd001d405, 0xd001d001, 0xc0ffffff, 0x4057c0ff, 0x40014005, 0x40014001,
+  0x03ffffff, 0x015703ff, 0x40014005, 0x40014001, 0x0fffffff, 0x05550fff, 0x40014001, 0x40014001,
+  0xffffffff, 0xf550fff0, 0xf400f400, 0xf401f401, 0xffffffff, 0xfd40ffc0, 0xf401fd00, 0xf401f401,
+  0xffffffff, 0xff03ff03, 0xf401fd01, 0xf401f401, 0xffffffff, 0xfc0ffc0f, 0xf407fc0f, 0xf407f407,
+  0xffffffff, 0xf03ff03f, 0xd007d01f, 0xd007d007, 0xffffffff, 0xc05fc0ff, 0xd007c01f, 0xd007d007,
+  0xffffffff, 0x015703ff, 0x40070007, 0xd0075007, 0xffffffff, 0x05550fff, 0x40010001, 0x40014001,
+  0xffffffff, 0xf550ffff, 0xf400f400, 0xf405f401, 0xffffffff, 0xfd40ffff, 0xfc00fd00, 0xfd57fd07,
+  0xffffffff, 0xff03ffff, 0xfc03ff03, 0xfd57fd07, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xffffffff, 0xf03fffff, 0xf00ff03f, 0xf55ff41f, 0xffffffff, 0xc05fffff, 0xc00fc01f, 0xf55ff41f,
+  0xffffffff, 0x0157ffff, 0x00070007, 0xd407d007, 0xffffffff, 0x0555ffff, 0x00010001, 0x50014001,
+  0xffffffff, 0xf557ffff, 0xf400f400, 0xf407f400, 0xffffffff, 0xfd5fffff, 0xfc00fd00, 0xfd5ffd00,
+  0xffffffff, 0xffffffff, 0xfe03ff03, 0xffffff03, 0xffffffff, 0xffffffff, 0xfc0ffc0f, 0xfffffc0f,
+  0xffffffff, 0xffffffff, 0xf02ff03f, 0xfffff03f, 0xffffffff, 0xfd5fffff, 0xc00fc01f, 0xfd5fc01f,
+  0xffffffff, 0xf557ffff, 0x00070007, 0xf4070007, 0xffffffff, 0xd555ffff, 0x00010001, 0xd0010001,
+  0xffffffff, 0xf555ffff, 0xf400f401, 0xf400f400, 0xffffffff, 0xfd57ffff, 0xfc00fd07, 0xfd40fd00,
+  0xffffffff, 0xfd5fffff, 0xfc03fd1f, 0xff03ff03, 0xffffffff, 0xfd5fffff, 0xfc0ffd1f, 0xfc0ffc0f,
+  0xffffffff, 0xfd5fffff, 0xf00ffd1f, 0xf03ff03f, 0xffffffff, 0xf55fffff, 0xc00ff41f, 0xc05fc01f,
+  0xffffffff, 0xd557ffff, 0x0007d007, 0x00070007, 0xffffffff, 0x5555ffff, 0x00014001, 0x00010001,
+  0xffffffff, 0xf555ffff, 0xf400f401, 0xf400f400, 0xffffffff, 0xf557ffff, 0xf401f405, 0xfd00fd00,
+  0xffffffff, 0xf557ffff, 0xf407f407, 0xff03fd03, 0xffffffff, 0xf557ffff, 0xf407f407, 0xfc0ffc0f,
+  0xffffffff, 0xf557ffff, 0xf407f407, 0xf03ff01f, 0xffffffff, 0xf557ffff, 0xd007d407, 0xc01fc01f,
+  0xffffffff, 0xd557ffff, 0x40075007, 0x00070007, 0xffffffff, 0x5555ffff, 0x40014001, 0x00010001,
+  0xfff0fff0, 0xffffffff, 0xff40ff55, 0xff40ff40, 0xffc0ffc0, 0xffffffff, 0xff40ff55, 0xff40ff40,
+  0xff03ff03, 0xffffffff, 0xff40ff55, 0xff40ff40, 0xfc0ffc0f, 0xffffffff, 0xff40ff55, 0xff40ff40,
+  0xf03ff03f, 0xffffffff, 0xff40ff55, 0xff40ff40, 0xc0ffc0ff, 0xffffffff, 0xff40ff55, 0xff40ff40,
+  0x03ff03ff, 0xffffffff, 0xff40ff55, 0xff40ff40, 0x0fff0fff, 0xffffffff, 0xff40ff55, 0xff40ff40,
+  0xfff0fff0, 0xfffffff0, 0xff40ff55, 0xff40ff40, 0xffc0ffc0, 0xffffffc0, 0xff40ff55, 0xff40ff40,
+  0xff03ff03, 0xffffff03, 0xff40ff55, 0xff40ff40, 0xfc0ffc0f, 0xfffffc0f, 0xff40ff55, 0xff40ff40,
+  0xf03ff03f, 0xfffff03f, 0xff40ff55, 0xff40ff40, 0xc0ffc0ff, 0xffffc0ff, 0xff40ff55, 0xff40ff40,
+  0x03ff03ff, 0xffff03ff, 0xff40ff55, 0xff40ff40, 0x0fff0fff, 0xffff0fff, 0xff40ff55, 0xff40ff40,
+  0xfff0ffff, 0xfff0fff0, 0xff40ff55, 0xff40ff40, 0xffc0ffff, 0xffc0ffc0, 0xff40ff55, 0xff40ff40,
+  0xff03ffff, 0xff03ff03, 0xff40ff55, 0xff40ff40, 0xfc0fffff, 0xfc0ffc0f, 0xff40ff55, 0xff40ff40,
+  0xf03fffff, 0xf03ff03f, 0xff40ff55, 0xff40ff40, 0xc0ffffff, 0xc0ffc0ff, 0xff40ff55, 0xff40ff40,
+  0x03ffffff, 0x03ff03ff, 0xff40ff55, 0xff40ff40, 0x0fffffff, 0x0fff0fff, 0xff40ff55, 0xff40ff40,
+  0xffffffff, 0xfff0fff0, 0xff40ff50, 0xff40ff40, 0xffffffff, 0xffc0ffc0, 0xff40ff40, 0xff40ff40,
+  0xffffffff, 0xff03ff03, 0xff40ff01, 0xff40ff40, 0xffffffff, 0xfc0ffc0f, 0xff40fc05, 0xff40ff40,
+  0xffffffff, 0xf03ff03f, 0xff40f015, 0xff40ff40, 0xffffffff, 0xc0ffc0ff, 0xff40c055, 0xff40ff40,
+  0xffffffff, 0x03ff03ff, 0xff400355, 0xff40ff40, 0xffffffff, 0x0fff0fff, 0xff400f55, 0xff40ff40,
+  0xffffffff, 0xfff0ffff, 0xff40ff50, 0xff40ff40, 0xffffffff, 0xffc0ffff, 0xff40ffc0, 0xff40ff40,
+  0xffffffff, 0xff03ffff, 0xff00ff01, 0xff40ff40, 0xffffffff, 0xfc0fffff, 0xfc00fc05, 0xff40ff40,
+  0xffffffff, 0xf03fffff, 0xf000f015, 0xff40ff40, 0xffffffff, 0xc0ffffff, 0xc040c055, 0xff40ff40,
+  0xffffffff, 0x03ffffff, 0x03400355, 0xff40ff40, 0xffffffff, 0x0fffffff, 0x0f400f55, 0xff40ff40,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffc0ffc0, 0xffd0ffc0,
+  0xffffffff, 0xffffffff, 0xff00ff01, 0xffd0ff00, 0xffffffff, 0xffffffff, 0xfc00fc05, 0xff40fc00,
+  0xffffffff, 0xffffffff, 0xf000f015, 0xff40f000, 0xffffffff, 0xffffffff, 0xc040c055, 0xff40c040,
+  0xffffffff, 0xffffffff, 0x03400355, 0xff400340, 0xffffffff, 0xffffffff, 0x0f400f55, 0xff400f40,
+  0xffffffff, 0xffffffff, 0xff50ffff, 0xff40ff40, 0xffffffff, 0xffffffff, 0xffc0ffff, 0xffc0ffc0,
+  0xffffffff, 0xffffffff, 0xff00fff5, 0xff00ff00, 0xffffffff, 0xffffffff, 0xfc00ffd5, 0xfc00fc00,
+  0xffffffff, 0xffffffff, 0xf000ff55, 0xf000f000, 0xffffffff, 0xffffffff, 0xc040ff55, 0xc040c040,
+  0xffffffff, 0xffffffff, 0x0340ff55, 0x03400340, 0xffffffff, 0xffffffff, 0x0f40ff55, 0x0f400f40,
+  0xffffffff, 0xffffffff, 0xff50ffd5, 0xff40ff40, 0xffffffff, 0xffffffff, 0xfff4fff5, 0xffc0ffc0,
+  0xffffffff, 0xffffffff, 0xffd0ffd5, 0xff00ff00, 0xffffffff, 0xffffffff, 0xff40ff55, 0xfc00fc00,
+  0xffffffff, 0xffffffff, 0xff40ff55, 0xf000f000, 0xffffffff, 0xffffffff, 0xff40ff55, 0xc040c040,
+  0xffffffff, 0xffffffff, 0xff40ff55, 0x03400340, 0xffffffff, 0xffffffff, 0xff40ff55, 0x0f400f40,
+  0xfff0fff0, 0xffffffff, 0xfd00fd55, 0xfd00fd00, 0xffc0ffc0, 0xffffffff, 0xfd00fd55, 0xfd00fd00,
+  0xff03ff03, 0xffffffff, 0xfd00fd55, 0xfd00fd00, 0xfc0ffc0f, 0xffffffff, 0xfd00fd55, 0xfd00fd00,
+  0xf03ff03f, 0xffffffff, 0xfd00fd55, 0xfd00fd00, 0xc0ffc0ff, 0xffffffff, 0xfd00fd55, 0xfd00fd00,
+  0x03ff03ff, 0xffffffff, 0xfd00fd55, 0xfd00fd00, 0x0fff0fff, 0xffffffff, 0xfd00fd55, 0xfd00fd00,
+  0xfff0fff0, 0xfffffff0, 0xfd00fd55, 0xfd00fd00, 0xffc0ffc0, 0xffffffc0, 0xfd00fd55, 0xfd00fd00,
+  0xff03ff03, 0xffffff03, 0xfd00fd55, 0xfd00fd00, 0xfc0ffc0f, 0xfffffc0f, 0xfd00fd55, 0xfd00fd00,
+  0xf03ff03f, 0xfffff03f, 0xfd00fd55, 0xfd00fd00, 0xc0ffc0ff, 0xffffc0ff, 0xfd00fd55, 0xfd00fd00,
+  0x03ff03ff, 0xffff03ff, 0xfd00fd55, 0xfd00fd00, 0x0fff0fff, 0xffff0fff, 0xfd00fd55, 0xfd00fd00,
+  0xfff0ffff, 0xfff0fff0, 0xfd00fd55, 0xfd00fd00, 0xffc0ffff, 0xffc0ffc0, 0xfd00fd55, 0xfd00fd00,
+  0xff03ffff, 0xff03ff03, 0xfd00fd55, 0xfd00fd00, 0xfc0fffff, 0xfc0ffc0f, 0xfd00fd55, 0xfd00fd00,
+  0xf03fffff, 0xf03ff03f, 0xfd00fd55, 0xfd00fd00, 0xc0ffffff, 0xc0ffc0ff, 0xfd00fd55, 0xfd00fd00,
+  0x03ffffff, 0x03ff03ff, 0xfd00fd55, 0xfd00fd00, 0x0fffffff, 0x0fff0fff, 0xfd00fd55, 0xfd00fd00,
+  0xffffffff, 0xfff0fff0, 0xff40ff50, 0xff40ff40, 0xffffffff, 0xffc0ffc0, 0xff40ff40, 0xff40ff40,
+  0xffffffff, 0xff03ff03, 0xff40ff01, 0xff40ff40, 0xffffffff, 0xfc0ffc0f, 0xfd00fc05, 0xff40fd40,
+  0xffffffff, 0xf03ff03f, 0xfd00f015, 0xff40fd40, 0xffffffff, 0xc0ffc0ff, 0xfd00c055, 0xfd00fd00,
+  0xffffffff, 0x03ff03ff, 0xfd000155, 0xfd00fd00, 0xffffffff, 0x0fff0fff, 0xfd000d55, 0xfd00fd00,
+  0xffffffff, 0xfff0ffff, 0xffd0fff0, 0xffd1ffc0, 0xffffffff, 0xffc0ffff, 0xffc0ffc0, 0xffd1ffc0,
+  0xffffffff, 0xff03ffff, 0xff01ff03, 0xffd1ffc0, 0xffffffff, 0xfc0fffff, 0xfc01fc05, 0xffd1ffc0,
+  0xffffffff, 0xf03fffff, 0xf000f015, 0xff40ff40, 0xffffffff, 0xc0ffffff, 0xc000c055, 0xfd00fd00,
+  0xffffffff, 0x03ffffff, 0x01000155, 0xfd00fd00, 0xffffffff, 0x0fffffff, 0x0d000d55, 0xfd00fd00,
+  0xffffffff, 0xffffffff, 0xfff0fff0, 0xfff6ffe0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xffffffff, 0xffffffff, 0xff03ff03, 0xff66ff00, 0xffffffff, 0xffffffff, 0xfc01fc05, 0xffd1fc00,
+  0xffffffff, 0xffffffff, 0xf000f015, 0xff40f000, 0xffffffff, 0xffffffff, 0xc000c055, 0xfd00c000,
+  0xffffffff, 0xffffffff, 0x01000155, 0xfd000100, 0xffffffff, 0xffffffff, 0x0d000d55, 0xfd000d00,
+  0xffffffff, 0xffffffff, 0xfff0ffff, 0xfff0ffe0, 0xffffffff, 0xffffffff, 0xffc0ffff, 0xffc0ffc0,
+  0xffffffff, 0xffffffff, 0xff03ffff, 0xff01ff02, 0xffffffff, 0xffffffff, 0xfc01ffd5, 0xfc01fc00,
+  0xffffffff, 0xffffffff, 0xf000ff55, 0xf000f000, 0xffffffff, 0xffffffff, 0xc000fd55, 0xc000c000,
+  0xffffffff, 0xffffffff, 0x0100fd55, 0x01000100, 0xffffffff, 0xffffffff, 0x0d00fd55, 0x0d000d00,
+  0xffffffff, 0xffffffff, 0xffd1ffd5, 0xfff0ffc0, 0xffffffff, 0xffffffff, 0xffd1ffd5, 0xffc0ffc0,
+  0xffffffff, 0xffffffff, 0xffd1ffd5, 0xff01ff00, 0xffffffff, 0xffffffff, 0xff41ff55, 0xfc00fc00,
+  0xffffffff, 0xffffffff, 0xfd00fd55, 0xf000f000, 0xffffffff, 0xffffffff, 0xfd00fd55, 0xc000c000,
+  0xffffffff, 0xffffffff, 0xfd00fd55, 0x01000100, 0xffffffff, 0xffffffff, 0xfd00fd55, 0x0d000d00,
+  0xfff0fff0, 0xffffffff, 0xf400f555, 0xf400f400, 0xffc0ffc0, 0xffffffff, 0xf400f555, 0xf400f400,
+  0xff03ff03, 0xffffffff, 0xf400f555, 0xf400f400, 0xfc0ffc0f, 0xffffffff, 0xf400f555, 0xf400f400,
+  0xf03ff03f, 0xffffffff, 0xf400f555, 0xf400f400, 0xc0ffc0ff, 0xffffffff, 0xf400f555, 0xf400f400,
+  0x03ff03ff, 0xffffffff, 0xf400f555, 0xf400f400, 0x0fff0fff, 0xffffffff, 0xf400f555, 0xf400f400,
+  0xfff0fff0, 0xfffffff0, 0xf400f555, 0xf400f400, 0xffc0ffc0, 0xffffffc0, 0xf400f555, 0xf400f400,
+  0xff03ff03, 0xffffff03, 0xf400f555, 0xf400f400, 0xfc0ffc0f, 0xfffffc0f, 0xf400f555, 0xf400f400,
+  0xf03ff03f, 0xfffff03f, 0xf400f555, 0xf400f400, 0xc0ffc0ff, 0xffffc0ff, 0xf400f555, 0xf400f400,
+  0x03ff03ff, 0xffff03ff, 0xf400f555, 0xf400f400, 0x0fff0fff, 0xffff0fff, 0xf400f555, 0xf400f400,
+  0xfff0ffff, 0xfff0fff0, 0xf400f555, 0xf400f400, 0xffc0ffff, 0xffc0ffc0, 0xf400f555, 0xf400f400,
+  0xff03ffff, 0xff03ff03, 0xf400f555, 0xf400f400, 0xfc0fffff, 0xfc0ffc0f, 0xf400f555, 0xf400f400,
+  0xf03fffff, 0xf03ff03f, 0xf400f555, 0xf400f400, 0xc0ffffff, 0xc0ffc0ff, 0xf400f555, 0xf400f400,
+  0x03ffffff, 0x03ff03ff, 0xf400f555, 0xf400f400, 0x0fffffff, 0x0fff0fff, 0xf400f555, 0xf400f400,
+  0xffffffff, 0xfff0fff0, 0xfd00fd50, 0xfd01fd01, 0xffffffff, 0xffc0ffc0, 0xfd01fd40, 0xfd01fd01,
+  0xffffffff, 0xff03ff03, 0xfd01fd01, 0xfd01fd01, 0xffffffff, 0xfc0ffc0f, 0xfd01fc05, 0xfd01fd01,
+  0xffffffff, 0xf03ff03f, 0xf401f015, 0xfd01f501, 0xffffffff, 0xc0ffc0ff, 0xf401c055, 0xfd01f501,
+  0xffffffff, 0x03ff03ff, 0xf4000155, 0xf400f400, 0xffffffff, 0x0fff0fff, 0xf4000555, 0xf400f400,
+  0xffffffff, 0xfff0ffff, 0xff40ff50, 0xff47ff03, 0xffffffff, 0xffc0ffff, 0xff40ffc0, 0xff47ff03,
+  0xffffffff, 0xff03ffff, 0xff03ff03, 0xff47ff03, 0xffffffff, 0xfc0fffff, 0xfc07fc0f, 0xff47ff03,
+  0xffffffff, 0xf03fffff, 0xf007f017, 0xff47ff03, 0xffffffff, 0xc0ffffff, 0xc001c055, 0xfd01fd01,
+  0xffffffff, 0x03ffffff, 0x00000155, 0xf400f400, 0xffffffff, 0x0fffffff, 0x04000555, 0xf400f400,
+  0xffffffff, 0xffffffff, 0xff40ff50, 0xff47ff00, 0xffffffff, 0xffffffff, 0xffc0ffc0, 0xffd9ff80,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xfc0ffc0f, 0xfd9ffc0b,
+  0xffffffff, 0xffffffff, 0xf007f017, 0xff47f003, 0xffffffff, 0xffffffff, 0xc001c055, 0xfd01c001,
+  0xffffffff, 0xffffffff, 0x00000155, 0xf4000000, 0xffffffff, 0xffffffff, 0x04000555, 0xf4000400,
+  0xffffffff, 0xffffffff, 0xff40ff57, 0xff40ff00, 0xffffffff, 0xffffffff, 0xffc0ffff, 0xffc0ff80,
+  0xffffffff, 0xffffffff, 0xff03ffff, 0xff03ff03, 0xffffffff, 0xffffffff, 0xfc0fffff, 0xfc0ffc0b,
+  0xffffffff, 0xffffffff, 0xf007ff57, 0xf007f003, 0xffffffff, 0xffffffff, 0xc001fd55, 0xc001c001,
+  0xffffffff, 0xffffffff, 0x0000f555, 0x00000000, 0xffffffff, 0xffffffff, 0x0400f555, 0x04000400,
+  0xffffffff, 0xffffffff, 0xff41ff55, 0xff40ff00, 0xffffffff, 0xffffffff, 0xff47ff57, 0xffc0ff00,
+  0xffffffff, 0xffffffff, 0xff47ff57, 0xff03ff03, 0xffffffff, 0xffffffff, 0xff47ff57, 0xfc0ffc03,
+  0xffffffff, 0xffffffff, 0xfd07fd57, 0xf007f003, 0xffffffff, 0xffffffff, 0xf401f555, 0xc001c001,
+  0xffffffff, 0xffffffff, 0xf400f555, 0x00000000, 0xffffffff, 0xffffffff, 0xf400f555, 0x04000400,
+  0xfff0fff0, 0xffffffff, 0xd001d555, 0xd001d001, 0xffc0ffc0, 0xffffffff, 0xd001d555, 0xd001d001,
+  0xff03ff03, 0xffffffff, 0xd001d555, 0xd001d001, 0xfc0ffc0f, 0xffffffff, 0xd001d555, 0xd001d001,
+  0xf03ff03f, 0xffffffff, 0xd001d555, 0xd001d001, 0xc0ffc0ff, 0xffffffff, 0xd001d555, 0xd001d001,
+  0x03ff03ff, 0xffffffff, 0xd001d555, 0xd001d001, 0x0fff0fff, 0xffffffff, 0xd001d555, 0xd001d001,
+  0xfff0fff0, 0xfffffff0, 0xd001d555, 0xd001d001, 0xffc0ffc0, 0xffffffc0, 0xd001d555, 0xd001d001,
+  0xff03ff03, 0xffffff03, 0xd001d555, 0xd001d001, 0xfc0ffc0f, 0xfffffc0f, 0xd001d555, 0xd001d001,
+  0xf03ff03f, 0xfffff03f, 0xd001d555, 0xd001d001, 0xc0ffc0ff, 0xffffc0ff, 0xd001d555, 0xd001d001,
+  0x03ff03ff, 0xffff03ff, 0xd001d555, 0xd001d001, 0x0fff0fff, 0xffff0fff, 0xd001d555, 0xd001d001,
+  0xfff0ffff, 0xfff0fff0, 0xd001d555, 0xd001d001, 0xffc0ffff, 0xffc0ffc0, 0xd001d555, 0xd001d001,
+  0xff03ffff, 0xff03ff03, 0xd001d555, 0xd001d001, 0xfc0fffff, 0xfc0ffc0f, 0xd001d555, 0xd001d001,
+  0xf03fffff, 0xf03ff03f, 0xd001d555, 0xd001d001, 0xc0ffffff, 0xc0ffc0ff, 0xd001d555, 0xd001d001,
+  0x03ffffff, 0x03ff03ff, 0xd001d555, 0xd001d001, 0x0fffffff, 0x0fff0fff, 0xd001d555, 0xd001d001,
+  0xffffffff, 0xfff0fff0, 0xf401f550, 0xf407f405, 0xffffffff, 0xffc0ffc0, 0xf401f540, 0xf407f405,
+  0xffffffff, 0xff03ff03, 0xf407f503, 0xf407f407, 0xffffffff, 0xfc0ffc0f, 0xf407f407, 0xf407f407,
+  0xffffffff, 0xf03ff03f, 0xf407f017, 0xf407f407, 0xffffffff, 0xc0ffc0ff, 0xd007c057, 0xf407d407,
+  0xffffffff, 0x03ff03ff, 0xd0070157, 0xf407d407, 0xffffffff, 0x0fff0fff, 0xd0010555, 0xd001d001,
+  0xffffffff, 0xfff0ffff, 0xf400f550, 0xf407f407, 0xffffffff, 0xffc0ffff, 0xfd00fd40, 0xfd1ffc0f,
+  0xffffffff, 0xff03ffff, 0xfd03ff03, 0xfd1ffc0f, 0xffffffff, 0xfc0fffff, 0xfc0ffc0f, 0xfd1ffc0f,
+  0xffffffff, 0xf03fffff, 0xf01ff03f, 0xfd1ffc0f, 0xffffffff, 0xc0ffffff, 0xc01fc05f, 0xfd1ffc0f,
+  0xffffffff, 0x03ffffff, 0x00070157, 0xf407f407, 0xffffffff, 0x0fffffff, 0x00010555, 0xd001d001,
+  0xffffffff, 0xffffffff, 0xf400f550, 0xf407f400, 0xffffffff, 0xffffffff, 0xfd00fd40, 0xfd1ffc00,
+  0xffffffff, 0xffffffff, 0xff03ff03, 0xff67fe03, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xffffffff, 0xffffffff, 0xf03ff03f, 0xf67ff02f, 0xffffffff, 0xffffffff, 0xc01fc05f, 0xfd1fc00f,
+  0xffffffff, 0xffffffff, 0x00070157, 0xf4070007, 0xffffffff, 0xffffffff, 0x00010555, 0xd0010001,
+  0xffffffff, 0xffffffff, 0xf400f557, 0xf400f400, 0xffffffff, 0xffffffff, 0xfd00fd5f, 0xfd00fc00,
+  0xffffffff, 0xffffffff, 0xff03ffff, 0xff03fe03, 0xffffffff, 0xffffffff, 0xfc0fffff, 0xfc0ffc0f,
+  0xffffffff, 0xffffffff, 0xf03fffff, 0xf03ff02f, 0xffffffff, 0xffffffff, 0xc01ffd5f, 0xc01fc00f,
+  0xffffffff, 0xffffffff, 0x0007f557, 0x00070007, 0xffffffff, 0xffffffff, 0x0001d555, 0x00010001,
+  0xffffffff, 0xffffffff, 0xf401f555, 0xf400f400, 0xffffffff, 0xffffffff, 0xfd07fd57, 0xfd00fc00,
+  0xffffffff, 0xffffffff, 0xfd1ffd5f, 0xff03fc03, 0xffffffff, 0xffffffff, 0xfd1ffd5f, 0xfc0ffc0f,
+  0xffffffff, 0xffffffff, 0xfd1ffd5f, 0xf03ff00f, 0xffffffff, 0xffffffff, 0xf41ff55f, 0xc01fc00f,
+  0xffffffff, 0xffffffff, 0xd007d557, 0x00070007, 0xffffffff, 0xffffffff, 0xd001d555, 0x00010001,
+  0xfff0fff0, 0xffffffff, 0xffd5ffff, 0xffd0ffd0, 0xffc0ffc0, 0xffffffff, 0xffd5ffff, 0xffd0ffd0,
+  0xff03ff03, 0xffffffff, 0xffd5ffff, 0xffd0ffd0, 0xfc0ffc0f, 0xffffffff, 0xffd5ffff, 0xffd0ffd0,
+  0xf03ff03f, 0xffffffff, 0xffd5ffff, 0xffd0ffd0, 0xc0ffc0ff, 0xffffffff, 0xffd5ffff, 0xffd0ffd0,
+  0x03ff03ff, 0xffffffff, 0xffd5ffff, 0xffd0ffd0, 0x0fff0fff, 0xffffffff, 0xffd5ffff, 0xffd0ffd0,
+  0xfff0fff0, 0xfffffff0, 0xffd5ffff, 0xffd0ffd0, 0xffc0ffc0, 0xffffffc0, 0xffd5ffff, 0xffd0ffd0,
+  0xff03ff03, 0xffffff03, 0xffd5ffff, 0xffd0ffd0, 0xfc0ffc0f, 0xfffffc0f, 0xffd5ffff, 0xffd0ffd0,
+  0xf03ff03f, 0xfffff03f, 0xffd5ffff, 0xffd0ffd0, 0xc0ffc0ff, 0xffffc0ff, 0xffd5ffff, 0xffd0ffd0,
+  0x03ff03ff, 0xffff03ff, 0xffd5ffff, 0xffd0ffd0, 0x0fff0fff, 0xffff0fff, 0xffd5ffff, 0xffd0ffd0,
+  0xfff0ffff, 0xfff0fff0, 0xffd5ffff, 0xffd0ffd0, 0xffc0ffff, 0xffc0ffc0, 0xffd5ffff, 0xffd0ffd0,
+  0xff03ffff, 0xff03ff03, 0xffd5ffff, 0xffd0ffd0, 0xfc0fffff, 0xfc0ffc0f, 0xffd5ffff, 0xffd0ffd0,
+  0xf03fffff, 0xf03ff03f, 0xffd5ffff, 0xffd0ffd0, 0xc0ffffff, 0xc0ffc0ff, 0xffd5ffff, 0xffd0ffd0,
+  0x03ffffff, 0x03ff03ff, 0xffd5ffff, 0xffd0ffd0, 0x0fffffff, 0x0fff0fff, 0xffd5ffff, 0xffd0ffd0,
+  0xffffffff, 0xfff0fff0, 0xffd5fff0, 0xffd0ffd0, 0xffffffff, 0xffc0ffc0, 0xffd5ffc0, 0xffd0ffd0,
+  0xffffffff, 0xff03ff03, 0xffd5ff03, 0xffd0ffd0, 0xffffffff, 0xfc0ffc0f, 0xffd5fc0f, 0xffd0ffd0,
+  0xffffffff, 0xf03ff03f, 0xffd5f03f, 0xffd0ffd0, 0xffffffff, 0xc0ffc0ff, 0xffd5c0ff, 0xffd0ffd0,
+  0xffffffff, 0x03ff03ff, 0xffd503ff, 0xffd0ffd0, 0xffffffff, 0x0fff0fff, 0xffd50fff, 0xffd0ffd0,
+  0xffffffff, 0xfff0ffff, 0xffd0fff0, 0xffd0ffd0, 0xffffffff, 0xffc0ffff, 0xffc0ffc0, 0xffd0ffd0,
+  0xffffffff, 0xff03ffff, 0xff01ff03, 0xffd0ffd0, 0xffffffff, 0xfc0fffff, 0xfc05fc0f, 0xffd0ffd0,
+  0xffffffff, 0xf03fffff, 0xf015f03f, 0xffd0ffd0, 0xffffffff, 0xc0ffffff, 0xc0d5c0ff, 0xffd0ffd0,
+  0xffffffff, 0x03ffffff, 0x03d503ff, 0xffd0ffd0, 0xffffffff, 0x0fffffff, 0x0fd50fff, 0xffd0ffd0,
+  0xffffffff, 0xffffffff, 0xfff0fff0, 0xfff0fff0, 0xffffffff, 0xffffffff, 0xffc0ffc0, 0xfff0ffc0,
+  0xffffffff, 0xffffffff, 0xff01ff03, 0xfff0ff00, 0xffffffff, 0xffffffff, 0xfc05fc0f, 0xffd0fc00,
+  0xffffffff, 0xffffffff, 0xf015f03f, 0xffd0f010, 0xffffffff, 0xffffffff, 0xc0d5c0ff, 0xffd0c0d0,
+  0xffffffff, 0xffffffff, 0x03d503ff, 0xffd003d0, 0xffffffff, 0xffffffff, 0x0fd50fff, 0xffd00fd0,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xffc0ffff, 0xffc0ffc0,
+  0xffffffff, 0xffffffff, 0xff01ffff, 0xff00ff00, 0xffffffff, 0xffffffff, 0xfc05ffff, 0xfc00fc00,
+  0xffffffff, 0xffffffff, 0xf015ffff, 0xf010f010, 0xffffffff, 0xffffffff, 0xc0d5ffff, 0xc0d0c0d0,
+  0xffffffff, 0xffffffff, 0x03d5ffff, 0x03d003d0, 0xffffffff, 0xffffffff, 0x0fd5ffff, 0x0fd00fd0,
+  0xffffffff, 0xffffffff, 0xff57ffff, 0xff40ff40, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0ffc0,
+  0xffffffff, 0xffffffff, 0xfff5ffff, 0xff00ff00, 0xffffffff, 0xffffffff, 0xffd5ffff, 0xfc00fc00,
+  0xffffffff, 0xffffffff, 0xffd5ffff, 0xf010f010, 0xffffffff, 0xffffffff, 0xffd5ffff, 0xc0d0c0d0,
+  0xffffffff, 0xffffffff, 0xffd5ffff, 0x03d003d0, 0xffffffff, 0xffffffff, 0xffd5ffff, 0x0fd00fd0,
+  0xfff0fff0, 0xffffffff, 0xff55ffff, 0xff40ff40, 0xffc0ffc0, 0xffffffff, 0xff55ffff, 0xff40ff40,
+  0xff03ff03, 0xffffffff, 0xff55ffff, 0xff40ff40, 0xfc0ffc0f, 0xffffffff, 0xff55ffff, 0xff40ff40,
+  0xf03ff03f, 0xffffffff, 0xff55ffff, 0xff40ff40, 0xc0ffc0ff, 0xffffffff, 0xff55ffff, 0xff40ff40,
+  0x03ff03ff, 0xffffffff, 0xff55ffff, 0xff40ff40, 0x0fff0fff, 0xffffffff, 0xff55ffff, 0xff40ff40,
+  0xfff0fff0, 0xfffffff0, 0xff55ffff, 0xff40ff40, 0xffc0ffc0, 0xffffffc0, 0xff55ffff, 0xff40ff40,
+  0xff03ff03, 0xffffff03, 0xff55ffff, 0xff40ff40, 0xfc0ffc0f, 0xfffffc0f, 0xff55ffff, 0xff40ff40,
+  0xf03ff03f, 0xfffff03f, 0xff55ffff, 0xff40ff40, 0xc0ffc0ff, 0xffffc0ff, 0xff55ffff, 0xff40ff40,
+  0x03ff03ff, 0xffff03ff, 0xff55ffff, 0xff40ff40, 0x0fff0fff, 0xffff0fff, 0xff55ffff, 0xff40ff40,
+  0xfff0ffff, 0xfff0fff0, 0xff55ffff, 0xff40ff40, 0xffc0ffff, 0xffc0ffc0, 0xff55ffff, 0xff40ff40,
+  0xff03ffff, 0xff03ff03, 0xff55ffff, 0xff40ff40, 0xfc0fffff, 0xfc0ffc0f, 0xff55ffff, 0xff40ff40,
+  0xf03fffff, 0xf03ff03f, 0xff55ffff, 0xff40ff40, 0xc0ffffff, 0xc0ffc0ff, 0xff55ffff, 0xff40ff40,
+  0x03ffffff, 0x03ff03ff, 0xff55ffff, 0xff40ff40, 0x0fffffff, 0x0fff0fff, 0xff55ffff, 0xff40ff40,
+  0xffffffff, 0xfff0fff0, 0xff55fff0, 0xff40ff40, 0xffffffff, 0xffc0ffc0, 0xff55ffc0, 0xff40ff40,
+  0xffffffff, 0xff03ff03, 0xff55ff03, 0xff40ff40, 0xffffffff, 0xfc0ffc0f, 0xff55fc0f, 0xff40ff40,
+  0xffffffff, 0xf03ff03f, 0xff55f03f, 0xff40ff40, 0xffffffff, 0xc0ffc0ff, 0xff55c0ff, 0xff40ff40,
+  0xffffffff, 0x03ff03ff, 0xff5503ff, 0xff40ff40, 0xffffffff, 0x0fff0fff, 0xff550fff, 0xff40ff40,
+  0xffffffff, 0xfff0ffff, 0xff50fff0, 0xff44ff40, 0xffffffff, 0xffc0ffff, 0xff40ffc0, 0xff44ff40,
+  0xffffffff, 0xff03ffff, 0xff01ff03, 0xff44ff40, 0xffffffff, 0xfc0fffff, 0xfc05fc0f, 0xff44ff40,
+  0xffffffff, 0xf03fffff, 0xf015f03f, 0xff40ff40, 0xffffffff, 0xc0ffffff, 0xc055c0ff, 0xff40ff40,
+  0xffffffff, 0x03ffffff, 0x035503ff, 0xff40ff40, 0xffffffff, 0x0fffffff, 0x0f550fff, 0xff40ff40,
+  0xffffffff, 0xffffffff, 0xfff0fff0, 0xffc8ffd0, 0xffffffff, 0xffffffff, 0xffc0ffc0, 0xffe6ffc0,
+  0xffffffff, 0xffffffff, 0xff03ff03, 0xffc8ff01, 0xffffffff, 0xffffffff, 0xfc05fc0f, 0xffc4fc01,
+  0xffffffff, 0xffffffff, 0xf015f03f, 0xff40f000, 0xffffffff, 0xffffffff, 0xc055c0ff, 0xff40c040,
+  0xffffffff, 0xffffffff, 0x035503ff, 0xff400340, 0xffffffff, 0xffffffff, 0x0f550fff, 0xff400f40,
+  0xffffffff, 0xffffffff, 0xfff0ffff, 0xffe0fff0, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xffffffff, 0xffffffff, 0xff03ffff, 0xff02ff03, 0xffffffff, 0xffffffff, 0xfc05ffff, 0xfc04fc01,
+  0xffffffff, 0xffffffff, 0xf015ffff, 0xf000f000, 0xffffffff, 0xffffffff, 0xc055ffff, 0xc040c040,
+  0xffffffff, 0xffffffff, 0x0355ffff, 0x03400340, 0xffffffff, 0xffffffff, 0x0f55ffff, 0x0f400f40,
+  0xffffffff, 0xffffffff, 0xffffffff, 0xffe0fff0, 0xffffffff, 0xffffffff, 0xffffffff, 0xffc0ffc0,
+  0xffffffff, 0xffffffff, 0xffffffff, 0xff02ff03, 0xffffffff, 0xffffffff, 0xffd5ffff, 0xfc00fc01,
+  0xffffffff, 0xffffffff, 0xff55ffff, 0xf000f000, 0xffffffff, 0xffffffff, 0xff55ffff, 0xc040c040,
+  0xffffffff, 0xffffffff, 0xff55ffff, 0x03400340, 0xffffffff, 0xffffffff, 0xff55ffff, 0x0f400f40,
+  0xfff0fff0, 0xffffffff, 0xfd55ffff, 0xfd01fd01, 0xffc0ffc0, 0xffffffff, 0xfd55ffff, 0xfd01fd01,
+  0xff03ff03, 0xffffffff, 0xfd55ffff, 0xfd01fd01, 0xfc0ffc0f, 0xffffffff, 0xfd55ffff, 0xfd01fd01,
+  0xf03ff03f, 0xffffffff, 0xfd55ffff, 0xfd01fd01, 0xc0ffc0ff, 0xffffffff, 0xfd55ffff, 0xfd01fd01,
+  0x03ff03ff, 0xffffffff, 0xfd55ffff, 0xfd01fd01, 0x0fff0fff, 0xffffffff, 0xfd55ffff, 0xfd01fd01,
+  0xfff0fff0, 0xfffffff0, 0xfd55ffff, 0xfd01fd01, 0xffc0ffc0, 0xffffffc0, 0xfd55ffff, 0xfd01fd01,
+  0xff03ff03, 0xffffff03, 0xfd55ffff, 0xfd01fd01, 0xfc0ffc0f, 0xfffffc0f, 0xfd55ffff, 0xfd01fd01,
+  0xf03ff03f, 0xfffff03f, 0xfd55ffff, 0xfd01fd01, 0xc0ffc0ff, 0xffffc0ff, 0xfd55ffff, 0xfd01fd01,
+  0x03ff03ff, 0xffff03ff, 0xfd55ffff, 0xfd01fd01, 0x0fff0fff, 0xffff0fff, 0xfd55ffff, 0xfd01fd01,
+  0xfff0ffff, 0xfff0fff0, 0xfd55ffff, 0xfd01fd01, 0xffc0ffff, 0xffc0ffc0, 0xfd55ffff, 0xfd01fd01,
+  0xff03ffff, 0xff03ff03, 0xfd55ffff, 0xfd01fd01, 0xfc0fffff, 0xfc0ffc0f, 0xfd55ffff, 0xfd01fd01,
+  0xf03fffff, 0xf03ff03f, 0xfd55ffff, 0xfd01fd01, 0xc0ffffff, 0xc0ffc0ff, 0xfd55ffff, 0xfd01fd01,
+  0x03ffffff, 0x03ff03ff, 0xfd55ffff, 0xfd01fd01, 0x0fffffff, 0x0fff0fff, 0xfd55ffff, 0xfd01fd01,
+  0xffffffff, 0xfff0fff0, 0xfd55fff0, 0xfd01fd01, 0xffffffff, 0xffc0ffc0, 0xfd55ffc0, 0xfd01fd01,
+  0xffffffff, 0xff03ff03, 0xfd55ff03, 0xfd01fd01, 0xffffffff, 0xfc0ffc0f, 0xfd55fc0f, 0xfd01fd01,
+  0xffffffff, 0xf03ff03f, 0xfd55f03f, 0xfd01fd01, 0xffffffff, 0xc0ffc0ff, 0xfd55c0ff, 0xfd01fd01,
+  0xffffffff, 0x03ff03ff, 0xfd5503ff, 0xfd01fd01, 0xffffffff, 0x0fff0fff, 0xfd550fff, 0xfd01fd01,
+  0xffffffff, 0xfff0ffff, 0xfd50fff0, 0xfd11fd01, 0xffffffff, 0xffc0ffff, 0xfd40ffc0, 0xfd11fd01,
+  0xffffffff, 0xff03ffff, 0xfd01ff03, 0xfd11fd01, 0xffffffff, 0xfc0fffff, 0xfc05fc0f, 0xfd11fd01,
+  0xffffffff, 0xf03fffff, 0xf015f03f, 0xfd11fd01, 0xffffffff, 0xc0ffffff, 0xc055c0ff, 0xfd01fd01,
+  0xffffffff, 0x03ffffff, 0x015503ff, 0xfd01fd01, 0xffffffff, 0x0fffffff, 0x0d550fff, 0xfd01fd01,
+  0xffffffff, 0xffffffff, 0xff50fff0, 0xff11ff40, 0xffffffff, 0xffffffff, 0xffc0ffc0, 0xff21ff40,
+  0xffffffff, 0xffffffff, 0xff03ff03, 0xff9bff03, 0xffffffff, 0xffffffff, 0xfc0ffc0f, 0xff23fc07,
+  0xffffffff, 0xffffffff, 0xf017f03f, 0xff13f007, 0xffffffff, 0xffffffff, 0xc055c0ff, 0xfd01c001,
+  0xffffffff, 0xffffffff, 0x015503ff, 0xfd010101, 0xffffffff, 0xffffffff, 0x0d550fff, 0xfd010d01,
+  0xffffffff, 0xffffffff, 0xff50ffff, 0xff10ff40, 0xffffffff, 0xffffffff, 0xffc0ffff, 0xff80ffc0,
+  0x00000000, 0x00000000, 0x00000000, 0x00000000, 0xffffffff, 0xffffffff, 0xfc0fffff, 0xfc0bfc0f,
+  0xffffffff, 0xffffffff, 0xf017ffff, 0xf013f007, 0xffffffff, 0xffffffff, 0xc055ffff, 0xc001c001,
+  0xffffffff, 0xffffffff, 0x0155ffff, 0x01010101, 0xffffffff, 0xffffffff, 0x0d55ffff, 0x0d010d01,
+  0xffffffff, 0xffffffff, 0xff57ffff, 0xff00ff40, 0xffffffff, 0xffffffff, 0xffffffff, 0xff80ffc0,
+  0xffffffff, 0xffffffff, 0xffffffff, 0xff03ff03, 0xffffffff, 0xffffffff, 0xffffffff, 0xfc0bfc0f,
+  0xffffffff, 0xffffffff, 0xff57ffff, 0xf003f007, 0xffffffff, 0xffffffff, 0xfd55ffff, 0xc001c001,
+  0xffffffff, 0xffffffff, 0xfd55ffff, 0x01010101, 0xffffffff, 0xffffffff, 0xfd55ffff, 0x0d010d01,
+  0xfff0fff0, 0xffffffff, 0xf557ffff, 0xf407f407, 0xffc0ffc0, 0xffffffff, 0xf557ffff, 0xf407f407,
+  0xff03ff03, 0xffffffff, 0xf557ffff, 0xf407f407, 0xfc0ffc0f, 0xffffffff, 0xf557ffff, 0xf407f407,
+  0xf03ff03f, 0xffffffff, 0xf557ffff, 0xf407f407, 0xc0ffc0ff, 0xffffffff, 0xf557ffff, 0xf407f407,
+  0x03ff03ff, 0xffffffff, 0xf557ffff, 0xf407f407, 0x0fff0fff, 0xffffffff, 0xf557ffff, 0xf407f407,
+  0xfff0fff0, 0xfffffff0, 0xf557ffff, 0xf407f407, 0xffc0ffc0, 0xffffffc0, 0xf557ffff, 0xf407f407,
+  0xff03ff03, 0xffffff03, 0xf557ffff, 0xf407f407, 0xfc0ffc0f, 0xfffffc0f, 0xf557ffff, 0xf407f407,
+  0xf03ff03f, 0xfffff03f, 0xf557ffff, 0xf407f407, 0xc0ffc0ff, 0xffffc0ff, 0xf557ffff, 0xf407f407,
+  0x03ff03ff, 0xffff03ff, 0xf557ffff, 0xf407f407, 0x0fff0fff, 0xffff0fff, 0xf557ffff, 0xf407f407,
+  0xfff0ffff, 0xfff0fff0, 0xf557ffff, 0xf407f407, 0xffc0ffff, 0xffc0ffc0, 0xf557ffff, 0xf407f407,
+  0xff03ffff, 0xff03ff03, 0xf557ffff, 0xf407f407, 0xfc0fffff, 0xfc0ffc0f, 0xf557ffff, 0xf407f407,
+  0xf03fffff, 0xf03ff03f, 0xf557ffff, 0xf407f407, 0xc0ffffff, 0xc0ffc0ff, 0xf557ffff, 0xf407f407,
+  0x03ffffff, 0x03ff03ff, 0xf557ffff, 0xf407f407, 0x0fffffff, 0x0fff0fff, 0xf557ffff, 0xf407f407,
+  0xffffffff, 0xfff0fff0, 0xf557fff0, 0xf407f407, 0xffffffff, 0xffc0ffc0, 0xf557ffc0, 0xf407f407,
+  0xffffffff, 0xff03ff03, 0xf557ff03, 0xf407f407, 0xffffffff, 0xfc0ffc0f, 0xf557fc0f, 0xf407f407,
+  0xffffffff, 0xf03ff03f, 0xf557f03f, 0xf407f407, 0xffffffff, 0xc0ffc0ff, 0xf557c0ff, 0xf407f407,
+  0xffffffff, 0x03ff03ff, 0xf55703ff, 0xf407f407, 0xffffffff, 0x0fff0fff, 0xf5570fff, 0xf407f407,
+  0xffffffff, 0xfff0ffff, 0xf550fff0, 0xf407f407, 0xffffffff, 0xffc0ffff, 0xf540ffc0, 0xf447f407,
+  0xffffffff, 0xff03ffff, 0xf503ff03, 0xf447f407, 0xffffffff, 0xfc0fffff, 0xf407fc0f, 0xf447f407,
+  0xffffffff, 0xf03fffff, 0xf017f03f, 0xf447f407, 0xffffffff, 0xc0ffffff, 0xc057c0ff, 0xf447f407,
+  0xffffffff, 0x03ffffff, 0x015703ff, 0xf407f407, 0xffffffff, 0x0fffffff, 0x05570fff, 0xf407f407,
+  0xffffffff, 0xffffffff, 0xf550fff0, 0xf407f400, 0xffffffff, 0xffffffff, 0xfd40ffc0, 0xfc4ffd00,
+  0xffffffff, 0xffffffff, 0xff03ff03, 0xfc8ffd03, 0xffffffff, 0xffffffff, 0xfc0ffc0f, 0xfe6ffc0f,
+  0xffffffff, 0xffffffff, 0xf03ff03f, 0xfc8ff01f, 0xffffffff, 0xffffffff, 0xc05fc0ff, 0xfc4fc01f,
+  0xffffffff, 0xffffffff, 0x015703ff, 0xf4070007, 0xffffffff, 0xffffffff, 0x05570fff, 0xf4070407,
+  0xffffffff, 0xffffffff, 0xf550ffff, 0xf400f400, 0xffffffff, 0xffffffff, 0xfd40ffff, 0xfc40fd00,
+  0xffffffff, 0xffffffff, 0xff03ffff, 0xfe03ff03, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+  0xffffffff, 0xffffffff, 0xf03fffff, 0xf02ff03f, 0xffffffff, 0xffffffff, 0xc05fffff, 0xc04fc01f,
+  0xffffffff, 0xffffffff, 0x0157ffff, 0x00070007, 0xffffffff, 0xffffffff, 0x0557ffff, 0x04070407,
+  0xffffffff, 0xffffffff, 0xf557ffff, 0xf400f400, 0xffffffff, 0xffffffff, 0xfd5fffff, 0xfc00fd00,
+  0xffffffff, 0xffffffff, 0xffffffff, 0xfe03ff03, 0xffffffff, 0xffffffff, 0xffffffff, 0xfc0ffc0f,
+  0xffffffff, 0xffffffff, 0xffffffff, 0xf02ff03f, 0xffffffff, 0xffffffff, 0xfd5fffff, 0xc00fc01f,
+  0xffffffff, 0xffffffff, 0xf557ffff, 0x00070007, 0xffffffff, 0xffffffff, 0xf557ffff, 0x04070407
+};
+
+#endif // !defined(KPKTAB_H_INCLUDED)
@@ -0,0 +1,107 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2012 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(MAGICTAB_H_INCLUDED)
+#define MAGICTAB_H_INCLUDED
+
+#include "types.h"
+
+/// Rook and bishop magics found by init_magics() with its fixed random sequence,
+/// indexed by [Is64Bit][square]. Generated with the "tables magics" command of
+/// a 32 and of a 64 bit build: do not edit, run "tables" to verify them.
+
+static const Bitboard RookMagics[2][64] = {
+  { // 32 bit
+    0x8840800800101121ULL, 0x003e004020400020ULL, 0x8230420044010084ULL, 0x0008c01204008024ULL,
+    0x8041005084080834ULL, 0x0040029900400334ULL, 0x0101020000800083ULL, 0xa400208880200041ULL,
+    0x1000600004402030ULL, 0x40c0600000004010ULL, 0x4480122181408060ULL, 0x000a028001008030ULL,
+    0x2200906041022041ULL, 0x6008102020840104ULL, 0x0282508000008001ULL, 0x0006c00840088081ULL,
+    0x00c6219091900040ULL, 0x4a214008000c0808ULL, 0x100408c80140a020ULL, 0x0a49100000008808ULL,
+    0x0044009560420808ULL, 0x0041100200840042ULL, 0x0004012200904a02ULL, 0x1010468004c44101ULL,
+    0x2292284221025182ULL, 0x88354080800208c2ULL, 0x4082001919024422ULL, 0x4100100003400821ULL,
+    0x0100080080141015ULL, 0x2a2c001200000901ULL, 0x00120a110c8a9014ULL, 0x09c0410400000082ULL,
+    0x10404020006a408cULL, 0x0040005000082132ULL, 0x348010001100a020ULL, 0x0100082000401001ULL,
+    0x0410080044801004ULL, 0x9040060000004091ULL, 0x0100220a10400401ULL, 0x20801080080400c1ULL,
+    0x006480000c049040ULL, 0x50004002000c4020ULL, 0x0404080402024114ULL, 0x1001001822002089ULL,
+    0x2040408802080402ULL, 0x00804140968c8211ULL, 0x2008083000000322ULL, 0x001c808042900061ULL,
+    0x00400a8000022880ULL, 0x220128100bc00408ULL, 0x008640802002a010ULL, 0x0048034040001004ULL,
+    0x080840800081a004ULL, 0x000289000000201cULL, 0x04c0202004085601ULL, 0x4088430000144881ULL,
+    0x0300501290002492ULL, 0x00810c2120009040ULL, 0x488020164800084aULL, 0x1850000560407109ULL,
+    0x0100121104800428ULL, 0x080402010005280cULL, 0x410000d3024804aaULL, 0x4000244b51400081ULL
+  },
+  { // 64 bit
+    0x008000400020801aULL, 0x0840004020001003ULL, 0x8880200010018108ULL, 0x0480040800801001ULL,
+    0x0900080002050010ULL, 0x0200100804010200ULL, 0x0200010084080200ULL, 0x0200024100821224ULL,
+    0x08a0802080004000ULL, 0x0006401004402000ULL, 0x0800802000100080ULL, 0x4004800803100081ULL,
+    0x0106000810200600ULL, 0x2981000802040100ULL, 0x0004000804018210ULL, 0x0201000192026300ULL,
+    0x1038218000804000ULL, 0x1010004000200040ULL, 0x0108420012002881ULL, 0x2098008008100080ULL,
+    0x4088010004090010ULL, 0x2000808002000400ULL, 0x028a0c0008021025ULL, 0x0000220000810064ULL,
+    0x0040400480208000ULL, 0x8040200040100042ULL, 0x2000100080802000ULL, 0x3090004040080401ULL,
+    0x0100080080800400ULL, 0x8230020080800400ULL, 0x0002000200080104ULL, 0x0c00010200004084ULL,
+    0x0000400082800020ULL, 0x0400200080804007ULL, 0x8400801000802001ULL, 0x0018100080800800ULL,
+    0x0810310005004800ULL, 0x8000020080800400ULL, 0x2000302134000208ULL, 0x0000298402000645ULL,
+    0x0000800140018022ULL, 0x00184020100c4000ULL, 0x6210002804002000ULL, 0x0001000c10010020ULL,
+    0x4201000800110004ULL, 0x2002000810020004ULL, 0xa40c21480a040090ULL, 0x0000004081020004ULL,
+    0x3302410080002300ULL, 0x9210002000401040ULL, 0x0092110041200300ULL, 0x0100100109002300ULL,
+    0x000a800800240280ULL, 0x0100040080020080ULL, 0x0000506201080400ULL, 0x1002209110440600ULL,
+    0x0140800300182241ULL, 0x8280184280220102ULL, 0x0005118042000a22ULL, 0x008a000890204006ULL,
+    0x000200304844204aULL, 0x108200080930041aULL, 0x0482000100840842ULL, 0x0012192404430182ULL
+  }
+};
+
+static const Bitboard BishopMagics[2][64] = {
+  { // 32 bit
+    0x2090a20001220404ULL, 0x0280510a00031802ULL, 0x804010420c240404ULL, 0x0000241080181491ULL,
+    0x00004840c0040420ULL, 0x0640802101291088ULL, 0x08088023885400acULL, 0x0160022200808611ULL,
+    0x2104440060025045ULL, 0x0b0c511104020244ULL, 0x01a024a818400808ULL, 0x2080611100420504ULL,
+    0x1000240414080242ULL, 0x0220001150000282ULL, 0x480a40c003d02041ULL, 0x0822030100402282ULL,
+    0x30220a9004100022ULL, 0x3001005410300888ULL, 0x2028a02060300009ULL, 0x2102600030009201ULL,
+    0x142008248100940cULL, 0x00c602000001050aULL, 0x009010c042108001ULL, 0x0088040940582009ULL,
+    0x2804410045884000ULL, 0x0848090008452101ULL, 0x04240450202c0214ULL, 0x8082040400140401ULL,
+    0x0c81005890804040ULL, 0x0070108000021080ULL, 0x00a8210010050140ULL, 0x0104481020133048ULL,
+    0x080c705008080809ULL, 0x000e100000040148ULL, 0x1004284000050028ULL, 0x0084054000800208ULL,
+    0x8240110004240424ULL, 0x01610481000600c2ULL, 0x8283012142214842ULL, 0x8080610001090401ULL,
+    0x09184000600e4909ULL, 0x0440020813054412ULL, 0x0404880028201a68ULL, 0x080400808800084aULL,
+    0x10158b8094091089ULL, 0x01210200000218a8ULL, 0x0040cc08000c2882ULL, 0x0044012241124202ULL,
+    0x2006000080908405ULL, 0x0c06010001444402ULL, 0x40b0000060084241ULL, 0x4082110350121421ULL,
+    0x20c100600a0a0060ULL, 0x04043002000808e0ULL, 0x01620a2008b02001ULL, 0x0501080085080701ULL,
+    0x00900a0005020242ULL, 0x04124800a4200824ULL, 0x0090c40901050485ULL, 0x11421206000c0101ULL,
+    0x1450440081092200ULL, 0x05080080000002e4ULL, 0x1102020400d02e04ULL, 0x0450a02010400464ULL
+  },
+  { // 64 bit
+    0x4404700420508600ULL, 0x9120018401104008ULL, 0x4004010401100084ULL, 0x0051040080062000ULL,
+    0x1124042010010092ULL, 0x1100882108001000ULL, 0x180a280248040000ULL, 0x0038440210900400ULL,
+    0x80074210e1010301ULL, 0x0020101012004e42ULL, 0x8210100110411001ULL, 0x00008404108010a0ULL,
+    0x2060071040002804ULL, 0x6400020202211011ULL, 0x000c0d0111202000ULL, 0x8004050118020221ULL,
+    0x8005804088080910ULL, 0x6004a82001020200ULL, 0x0101001004002041ULL, 0x8a1800a082004282ULL,
+    0x8806001012100098ULL, 0x0022810040504000ULL, 0x4040800048480801ULL, 0x0a42041304824120ULL,
+    0x0204106085200814ULL, 0x0890110682040111ULL, 0x4000500001040080ULL, 0x0000808018020102ULL,
+    0x2401010010104008ULL, 0x1052008004100080ULL, 0x0000950104090801ULL, 0x1200808000220864ULL,
+    0x8188421201082050ULL, 0x0035011001a05c00ULL, 0x0051480201104400ULL, 0x4110040400180210ULL,
+    0x0414140400001100ULL, 0x4e60008100688040ULL, 0x000121022ac40200ULL, 0x00040042904a0094ULL,
+    0x2948010421001040ULL, 0x4060821011020200ULL, 0x0001004030008202ULL, 0x0018020122080401ULL,
+    0x0042ca41a2000400ULL, 0x01c0212040810100ULL, 0x1060480f41020041ULL, 0x020102020a040040ULL,
+    0x1082008220100402ULL, 0x0102020202828102ULL, 0x4022108848080004ULL, 0x0020400508480000ULL,
+    0x1010108590440010ULL, 0xd812040810a10140ULL, 0x0191043000a20038ULL, 0x8010020200620000ULL,
+    0x0001008801084280ULL, 0x0000060882015050ULL, 0x8120000100809001ULL, 0x0200100002104420ULL,
+    0x10d100200821010aULL, 0x03002c0448100110ULL, 0x14004005045c0042ULL, 0x4002901008831040ULL
+  }
+};
+
+#endif // !defined(MAGICTAB_H_INCLUDED)
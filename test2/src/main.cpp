@@ -19,34 +19,74 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "bitboard.h"
 #include "evaluate.h"
+#include "material.h"
 #include "position.h"
 #include "search.h"
+#include "searchlog.h"
 #include "thread.h"
 #include "tt.h"
 #include "ucioption.h"
 
+#if defined(USE_DISPATCH) && !defined(ARCH_SOURCE)
+namespace Popcnt { int main(int argc, char* argv[]); } // See arch.cpp
+namespace Bmi2   { int main(int argc, char* argv[]); }
+#endif
+
 int main(int argc, char* argv[]) {
 
-  std::cout << engine_info() << std::endl;
+#if defined(USE_DISPATCH) && !defined(ARCH_SOURCE)
+  // Hand over the whole run to the engine copy built for this CPU. Pext is
+  // slower than magics where it is microcoded, use the popcnt copy there.
+  const int Bmi2Features = CPU_POPCNT | CPU_BMI1 | CPU_BMI2;
+  int cpu = cpu_features();
+
+  if ((cpu & (Bmi2Features | CPU_SLOW_PEXT)) == Bmi2Features)
+      return Bmi2::main(argc, argv);
+
+  if (cpu & CPU_POPCNT)
+      return Popcnt::main(argc, argv);
+#endif
+
+  // A binary built for some instruction set extensions would crash later on
+  // with an illegal instruction, better to tell why and quit now.
+  if (   (HasPopCnt && !(cpu_features() & CPU_POPCNT))
+      || (HasPext && !(cpu_features() & CPU_BMI2)))
+  {
+      std::cerr << "This CPU does not support the instruction set this binary has been built for" << std::endl;
+      return EXIT_FAILURE;
+  }
+
+  bool batch = argc > 1 && std::string(argv[1]) == "--batch";
+
+  if (!batch) // In batch mode stdout is for the binary responses only
+      std::cout << engine_info() << std::endl;
 
   UCI::init(Options);
   Bitboards::init();
   Zobrist::init();
-  Bitbases::init_kpk();
+  MaterialTable::init();
   Search::init();
   Eval::init();
   Threads.init();
   TT.set_size(Options["Hash"]);
 
-  std::string args;
+  if (batch)
+      UCI::batch_loop(std::vector<std::string>(argv + 2, argv + argc));
+  else
+  {
+      std::string args;
 
-  for (int i = 1; i < argc; i++)
-      args += std::string(argv[i]) + " ";
+      for (int i = 1; i < argc; i++)
+          args += std::string(argv[i]) + " ";
 
-  UCI::loop(args);
+      UCI::loop(args);
+  }
 
+  SearchLog::exit();
   Threads.exit();
+  return EXIT_SUCCESS; // Not implicit in the copies of arch.cpp, see there
 }
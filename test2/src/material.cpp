@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstring>
+#include <vector>
 
 #include "material.h"
 
@@ -58,39 +59,113 @@ namespace {
   Endgame<KPsK>   ScaleKPsK[]   = { Endgame<KPsK>(WHITE),   Endgame<KPsK>(BLACK) };
   Endgame<KPKP>   ScaleKPKP[]   = { Endgame<KPKP>(WHITE),   Endgame<KPKP>(BLACK) };
 
+  // Material configurations with no more pieces of each type than in the
+  // initial position are directly indexed, so that they are computed only once
+  // and shared by all the threads. Each piece count is a digit of the index, in
+  // a mixed radix where the digit of piece type pt has radix MaxCount[pt] + 1.
+  const int MaxCount[] = { 0, 8, 2, 2, 2, 1 };
+
+  std::vector<MaterialEntry> Configurations;
+
+  // The endgame functions are shared by all the threads. They are built on
+  // first use, after the Zobrist keys they are indexed by have been set up.
+  Endgames& endgames() { static Endgames e; return e; }
+
+  // configuration_index() returns the index of the position's material in the
+  // directly indexed table, or -1 if it has more pieces of some type (after an
+  // under-promotion or a second queen) and so must be hashed instead.
+  int configuration_index(const Position& pos) {
+
+    int idx = 0;
+
+    for (Color c = WHITE; c <= BLACK; c++)
+        for (PieceType pt = PAWN; pt <= QUEEN; pt++)
+        {
+            if (pos.piece_count(c, pt) > MaxCount[pt])
+                return -1;
+
+            idx = idx * (MaxCount[pt] + 1) + pos.piece_count(c, pt);
+        }
+
+    return idx;
+  }
+
+  // next_configuration() advances the piece counts, like an odometer whose
+  // last digit is the count of black queens, to the ones of the configuration
+  // with the next index, and updates the material key accordingly.
+  void next_configuration(int count[][8], Key& key) {
+
+    for (int c = BLACK; c >= WHITE; c--)
+        for (int pt = QUEEN; pt >= PAWN; pt--)
+        {
+            if (count[c][pt] < MaxCount[pt])
+            {
+                key ^= Zobrist::psq[c][pt][count[c][pt]++];
+                return;
+            }
+
+            while (count[c][pt])
+                key ^= Zobrist::psq[c][pt][--count[c][pt]];
+        }
+  }
+
   // Helper templates used to detect a given material distribution
-  template<Color Us> bool is_KXK(const Position& pos) {
+  template<Color Us> bool is_KXK(const int count[][8], const Value npm[]) {
     const Color Them = (Us == WHITE ? BLACK : WHITE);
-    return   pos.non_pawn_material(Them) == VALUE_ZERO
-          && pos.piece_count(Them, PAWN) == 0
-          && pos.non_pawn_material(Us)   >= RookValueMg;
+    return   npm[Them] == VALUE_ZERO
+          && count[Them][PAWN] == 0
+          && npm[Us] >= RookValueMg;
   }
 
-  template<Color Us> bool is_KBPsKs(const Position& pos) {
-    return   pos.non_pawn_material(Us)   == BishopValueMg
-          && pos.piece_count(Us, BISHOP) == 1
-          && pos.piece_count(Us, PAWN)   >= 1;
+  template<Color Us> bool is_KBPsKs(const int count[][8], const Value npm[]) {
+    return   npm[Us] == BishopValueMg
+          && count[Us][BISHOP] == 1
+          && count[Us][PAWN]   >= 1;
   }
 
-  template<Color Us> bool is_KQKRPs(const Position& pos) {
+  template<Color Us> bool is_KQKRPs(const int count[][8], const Value npm[]) {
     const Color Them = (Us == WHITE ? BLACK : WHITE);
-    return   pos.piece_count(Us, PAWN)    == 0
-          && pos.non_pawn_material(Us)    == QueenValueMg
-          && pos.piece_count(Us, QUEEN)   == 1
-          && pos.piece_count(Them, ROOK)  == 1
-          && pos.piece_count(Them, PAWN)  >= 1;
+    return   count[Us][PAWN]   == 0
+          && npm[Us]           == QueenValueMg
+          && count[Us][QUEEN]  == 1
+          && count[Them][ROOK] == 1
+          && count[Them][PAWN] >= 1;
   }
 
 } // namespace
 
 
+/// MaterialTable::init() computes the entries of all the directly indexed
+/// material configurations. It is called once at startup, after the Zobrist
+/// keys have been initialized.
+
+void MaterialTable::init() {
+
+  int count[2][8] = { { 0 } };
+  Key key = 0;
+
+  Configurations.resize(MaterialConfigurations);
+
+  for (int idx = 0; idx < MaterialConfigurations; idx++)
+  {
+      compute(&Configurations[idx], key, count);
+      next_configuration(count, key);
+  }
+}
+
+
 /// MaterialTable::probe() takes a position object as input, looks up a MaterialEntry
-/// object, and returns a pointer to it. If the material configuration is not
-/// already present in the table, it is computed and stored there, so we don't
-/// have to recompute everything when the same material configuration occurs again.
+/// object, and returns a pointer to it. Usual material configurations are read
+/// from the shared, directly indexed table and never miss. The others are looked
+/// up in the per-thread hash table and computed there when not already present.
 
 MaterialEntry* MaterialTable::probe(const Position& pos) {
 
+  int idx = configuration_index(pos);
+
+  if (idx >= 0)
+      return &Configurations[idx];
+
   Key key = pos.material_key();
   MaterialEntry* e = entries[key];
 
@@ -100,41 +175,62 @@ MaterialEntry* MaterialTable::probe(const Position& pos) {
   if (e->key == key)
       return e;
 
+  int count[2][8];
+
+  for (Color c = WHITE; c <= BLACK; c++)
+      for (PieceType pt = PAWN; pt <= QUEEN; pt++)
+          count[c][pt] = pos.piece_count(c, pt);
+
+  compute(e, key, count);
+  return e;
+}
+
+
+/// MaterialTable::compute() fills the entry of the material configuration with
+/// the given key and piece counts, indexed by color and piece type.
+
+void MaterialTable::compute(MaterialEntry* e, Key key, const int count[][8]) {
+
+  const Value npm[] = {
+    count[WHITE][KNIGHT] * KnightValueMg + count[WHITE][BISHOP] * BishopValueMg
+  + count[WHITE][ROOK]   * RookValueMg   + count[WHITE][QUEEN]  * QueenValueMg,
+    count[BLACK][KNIGHT] * KnightValueMg + count[BLACK][BISHOP] * BishopValueMg
+  + count[BLACK][ROOK]   * RookValueMg   + count[BLACK][QUEEN]  * QueenValueMg };
+
   memset(e, 0, sizeof(MaterialEntry));
   e->key = key;
   e->factor[WHITE] = e->factor[BLACK] = (uint8_t)SCALE_FACTOR_NORMAL;
-  e->gamePhase = MaterialTable::game_phase(pos);
+  e->gamePhase = MaterialTable::game_phase(npm[WHITE] + npm[BLACK]);
 
   // Let's look if we have a specialized evaluation function for this
   // particular material configuration. First we look for a fixed
   // configuration one, then a generic one if previous search failed.
-  if (endgames.probe(key, e->evaluationFunction))
-      return e;
+  if (endgames().probe(key, e->evaluationFunction))
+      return;
 
-  if (is_KXK<WHITE>(pos))
+  if (is_KXK<WHITE>(count, npm))
   {
       e->evaluationFunction = &EvaluateKXK[WHITE];
-      return e;
+      return;
   }
 
-  if (is_KXK<BLACK>(pos))
+  if (is_KXK<BLACK>(count, npm))
   {
       e->evaluationFunction = &EvaluateKXK[BLACK];
-      return e;
+      return;
   }
 
-  if (!pos.pieces(PAWN) && !pos.pieces(ROOK) && !pos.pieces(QUEEN))
+  if (   !count[WHITE][PAWN] && !count[WHITE][ROOK] && !count[WHITE][QUEEN]
+      && !count[BLACK][PAWN] && !count[BLACK][ROOK] && !count[BLACK][QUEEN])
   {
-      // Minor piece endgame with at least one minor piece per side and
-      // no pawns. Note that the case KmmK is already handled by KXK.
-      assert((pos.pieces(WHITE, KNIGHT) | pos.pieces(WHITE, BISHOP)));
-      assert((pos.pieces(BLACK, KNIGHT) | pos.pieces(BLACK, BISHOP)));
-
-      if (   pos.piece_count(WHITE, BISHOP) + pos.piece_count(WHITE, KNIGHT) <= 2
-          && pos.piece_count(BLACK, BISHOP) + pos.piece_count(BLACK, KNIGHT) <= 2)
+      // Minor piece endgame with no pawns. The configurations with a lone
+      // king, that the search never evaluates, end up here too and are drawn
+      // as well. KmmKm is a draw whatever the side to move.
+      if (   count[WHITE][BISHOP] + count[WHITE][KNIGHT] <= 2
+          && count[BLACK][BISHOP] + count[BLACK][KNIGHT] <= 2)
       {
-          e->evaluationFunction = &EvaluateKmmKm[pos.side_to_move()];
-          return e;
+          e->evaluationFunction = &EvaluateKmmKm[WHITE];
+          return;
       }
   }
 
@@ -145,43 +241,43 @@ MaterialEntry* MaterialTable::probe(const Position& pos) {
   // scaling functions and we need to decide which one to use.
   EndgameBase<ScaleFactor>* sf;
 
-  if (endgames.probe(key, sf))
+  if (endgames().probe(key, sf))
   {
       e->scalingFunction[sf->color()] = sf;
-      return e;
+      return;
   }
 
   // Generic scaling functions that refer to more then one material
   // distribution. Should be probed after the specialized ones.
   // Note that these ones don't return after setting the function.
-  if (is_KBPsKs<WHITE>(pos))
+  if (is_KBPsKs<WHITE>(count, npm))
       e->scalingFunction[WHITE] = &ScaleKBPsK[WHITE];
 
-  if (is_KBPsKs<BLACK>(pos))
+  if (is_KBPsKs<BLACK>(count, npm))
       e->scalingFunction[BLACK] = &ScaleKBPsK[BLACK];
 
-  if (is_KQKRPs<WHITE>(pos))
+  if (is_KQKRPs<WHITE>(count, npm))
       e->scalingFunction[WHITE] = &ScaleKQKRPs[WHITE];
 
-  else if (is_KQKRPs<BLACK>(pos))
+  else if (is_KQKRPs<BLACK>(count, npm))
       e->scalingFunction[BLACK] = &ScaleKQKRPs[BLACK];
 
-  Value npm_w = pos.non_pawn_material(WHITE);
-  Value npm_b = pos.non_pawn_material(BLACK);
+  Value npm_w = npm[WHITE];
+  Value npm_b = npm[BLACK];
 
   if (npm_w + npm_b == VALUE_ZERO)
   {
-      if (pos.piece_count(BLACK, PAWN) == 0)
+      if (count[BLACK][PAWN] == 0)
       {
-          assert(pos.piece_count(WHITE, PAWN) >= 2);
+          assert(count[WHITE][PAWN] >= 2);
           e->scalingFunction[WHITE] = &ScaleKPsK[WHITE];
       }
-      else if (pos.piece_count(WHITE, PAWN) == 0)
+      else if (count[WHITE][PAWN] == 0)
       {
-          assert(pos.piece_count(BLACK, PAWN) >= 2);
+          assert(count[BLACK][PAWN] >= 2);
           e->scalingFunction[BLACK] = &ScaleKPsK[BLACK];
       }
-      else if (pos.piece_count(WHITE, PAWN) == 1 && pos.piece_count(BLACK, PAWN) == 1)
+      else if (count[WHITE][PAWN] == 1 && count[BLACK][PAWN] == 1)
       {
           // This is a special case because we set scaling functions
           // for both colors instead of only one.
@@ -191,23 +287,23 @@ MaterialEntry* MaterialTable::probe(const Position& pos) {
   }
 
   // No pawns makes it difficult to win, even with a material advantage
-  if (pos.piece_count(WHITE, PAWN) == 0 && npm_w - npm_b <= BishopValueMg)
+  if (count[WHITE][PAWN] == 0 && npm_w - npm_b <= BishopValueMg)
   {
       e->factor[WHITE] = (uint8_t)
-      (npm_w == npm_b || npm_w < RookValueMg ? 0 : NoPawnsSF[std::min(pos.piece_count(WHITE, BISHOP), 2)]);
+      (npm_w == npm_b || npm_w < RookValueMg ? 0 : NoPawnsSF[std::min(count[WHITE][BISHOP], 2)]);
   }
 
-  if (pos.piece_count(BLACK, PAWN) == 0 && npm_b - npm_w <= BishopValueMg)
+  if (count[BLACK][PAWN] == 0 && npm_b - npm_w <= BishopValueMg)
   {
       e->factor[BLACK] = (uint8_t)
-      (npm_w == npm_b || npm_b < RookValueMg ? 0 : NoPawnsSF[std::min(pos.piece_count(BLACK, BISHOP), 2)]);
+      (npm_w == npm_b || npm_b < RookValueMg ? 0 : NoPawnsSF[std::min(count[BLACK][BISHOP], 2)]);
   }
 
   // Compute the space weight
   if (npm_w + npm_b >= 2 * QueenValueMg + 4 * RookValueMg + 2 * KnightValueMg)
   {
-      int minorPieceCount =  pos.piece_count(WHITE, KNIGHT) + pos.piece_count(WHITE, BISHOP)
-                           + pos.piece_count(BLACK, KNIGHT) + pos.piece_count(BLACK, BISHOP);
+      int minorPieceCount =  count[WHITE][KNIGHT] + count[WHITE][BISHOP]
+                           + count[BLACK][KNIGHT] + count[BLACK][BISHOP];
 
       e->spaceWeight = minorPieceCount * minorPieceCount;
   }
@@ -216,13 +312,12 @@ MaterialEntry* MaterialTable::probe(const Position& pos) {
   // for the bishop pair "extended piece", this allow us to be more flexible
   // in defining bishop pair bonuses.
   const int pieceCount[2][8] = {
-  { pos.piece_count(WHITE, BISHOP) > 1, pos.piece_count(WHITE, PAWN), pos.piece_count(WHITE, KNIGHT),
-    pos.piece_count(WHITE, BISHOP)    , pos.piece_count(WHITE, ROOK), pos.piece_count(WHITE, QUEEN) },
-  { pos.piece_count(BLACK, BISHOP) > 1, pos.piece_count(BLACK, PAWN), pos.piece_count(BLACK, KNIGHT),
-    pos.piece_count(BLACK, BISHOP)    , pos.piece_count(BLACK, ROOK), pos.piece_count(BLACK, QUEEN) } };
+  { count[WHITE][BISHOP] > 1, count[WHITE][PAWN], count[WHITE][KNIGHT],
+    count[WHITE][BISHOP]    , count[WHITE][ROOK], count[WHITE][QUEEN] },
+  { count[BLACK][BISHOP] > 1, count[BLACK][PAWN], count[BLACK][KNIGHT],
+    count[BLACK][BISHOP]    , count[BLACK][ROOK], count[BLACK][QUEEN] } };
 
   e->value = (int16_t)((imbalance<WHITE>(pieceCount) - imbalance<BLACK>(pieceCount)) / 16);
-  return e;
 }
 
 
@@ -262,13 +357,11 @@ int MaterialTable::imbalance(const int pieceCount[][8]) {
 }
 
 
-/// MaterialTable::game_phase() calculates the phase given the current
-/// position. Because the phase is strictly a function of the material, it
+/// MaterialTable::game_phase() calculates the phase given the non-pawn material
+/// of both sides. Because the phase is strictly a function of the material, it
 /// is stored in MaterialEntry.
 
-Phase MaterialTable::game_phase(const Position& pos) {
-
-  Value npm = pos.non_pawn_material(WHITE) + pos.non_pawn_material(BLACK);
+Phase MaterialTable::game_phase(Value npm) {
 
   return  npm >= MidgameLimit ? PHASE_MIDGAME
         : npm <= EndgameLimit ? PHASE_ENDGAME
@@ -26,7 +26,12 @@
 #include "types.h"
 
 
-const int MaterialTableSize = 8192;
+/// Only the material configurations with promoted pieces are hashed, the usual
+/// ones are directly indexed in a table shared by all the threads.
+const int MaterialTableSize = 1024;
+
+/// Number of directly indexed material configurations, 486 for each side
+const int MaterialConfigurations = 486 * 486;
 
 /// Game phase
 enum Phase {
@@ -55,6 +60,7 @@ public:
   int space_weight() const;
   Phase game_phase() const;
   bool specialized_eval_exists() const;
+  bool normal_scale_factors() const;
   Value evaluate(const Position& pos) const;
 
 private:
@@ -73,12 +79,15 @@ private:
 
 struct MaterialTable {
 
+  static void init();
   MaterialEntry* probe(const Position& pos);
-  static Phase game_phase(const Position& pos);
+  static Phase game_phase(Value npm);
   template<Color Us> static int imbalance(const int pieceCount[][8]);
 
   HashTable<MaterialEntry, MaterialTableSize> entries;
-  Endgames endgames;
+
+private:
+  static void compute(MaterialEntry* e, Key key, const int count[][8]);
 };
 
 
@@ -118,4 +127,13 @@ inline bool MaterialEntry::specialized_eval_exists() const {
   return evaluationFunction != NULL;
 }
 
+/// MaterialEntry::normal_scale_factors() returns true when the evaluation is
+/// never scaled, by a scaling function or a constant factor, for either side.
+
+inline bool MaterialEntry::normal_scale_factors() const {
+  return   !scalingFunction[WHITE] && !scalingFunction[BLACK]
+        &&  factor[WHITE] == SCALE_FACTOR_NORMAL
+        &&  factor[BLACK] == SCALE_FACTOR_NORMAL;
+}
+
 #endif // !defined(MATERIAL_H_INCLUDED)
@@ -17,6 +17,9 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <cstring>
+#include <ctime>
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -28,6 +31,21 @@
 #    include <sys/pstat.h>
 #endif
 
+#if !defined(_WIN32) && !defined(_WIN64)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#    include <intrin.h>
+#    define HAS_CPUID
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#    include <cpuid.h>
+#    define HAS_CPUID
+#endif
+
 using namespace std;
 
 /// Version number. If Version is left empty, then Tag plus current
@@ -47,6 +65,7 @@ const string engine_info(bool to_uci) {
   const string months("Jan Feb Mar Apr May Jun Jul Aug Sep Oct Nov Dec");
   const string cpu64(Is64Bit ? " 64bit" : "");
   const string popcnt(HasPopCnt ? " SSE4.2" : "");
+  const string bmi2(HasPext ? " BMI2" : "");
 
   string month, day, year;
   stringstream s, date(__DATE__); // From compiler, format is "Sep 21 2008"
@@ -61,7 +80,7 @@ const string engine_info(bool to_uci) {
         << setw(2) << (1 + months.find(month) / 4) << setw(2) << day;
   }
 
-  s << cpu64 << popcnt << (to_uci ? "\nid author ": " by ")
+  s << cpu64 << popcnt << bmi2 << (to_uci ? "\nid author ": " by ")
     << "Tord Romstad, Marco Costalba and Joona Kiiski :-=)";
 
   return s.str();
@@ -74,6 +93,10 @@ Time::point Time::now() {
   sys_time_t t; system_time(&t); return time_to_msec(t);
 }
 
+int64_t Time::now_us() {
+  sys_time_t t; system_time(&t); return time_to_usec(t);
+}
+
 
 /// Debug functions used mainly to collect run-time statistics
 
@@ -100,37 +123,206 @@ void dbg_print() {
 /// can toggle the logging of std::cout and std:cin at runtime while preserving
 /// usual i/o functionality and without changing a single line of code!
 /// Idea from http://groups.google.com/group/comp.lang.c++/msg/1d941c0f26ea0d81
+///
+/// The engine never writes to the file itself: each Tie copies whole lines with
+/// their timestamp into a ring buffer, and a background thread drains the rings
+/// to the file. When the rings are full new lines are dropped and counted, so
+/// memory stays bounded and a slow disk never stalls the search.
+
+namespace {
+
+// LogRing is a lock-free single producer, single consumer queue of log lines.
+// The producer is the thread reading cin, or the one holding the sync_cout lock,
+// and the consumer is the writer thread. A record is the line timestamp, then
+// the length and the characters of the line.
+
+class LogRing {
+
+  static const size_t Size = 1 << 20; // In bytes, must be a power of 2
+
+  std::vector<char> data;
+  volatile size_t head, tail; // Written only by the producer and the consumer
+
+  void write(size_t pos, const void* src, size_t n) {
+
+    for (size_t i = 0; i < n; i++)
+        data[(pos + i) & (Size - 1)] = ((const char*)src)[i];
+  }
+
+  void read(size_t pos, void* dst, size_t n) const {
+
+    for (size_t i = 0; i < n; i++)
+        ((char*)dst)[i] = data[(pos + i) & (Size - 1)];
+  }
+
+public:
+  LogRing() : data(Size), head(0), tail(0), dropped(0) {}
+
+  volatile size_t dropped;
+
+  bool half_full() const { return head - tail > Size / 2; }
+
+  void push(Time::point t, const char* prefix, const string& line) {
+
+    uint32_t len = uint32_t(strlen(prefix) + line.size());
+    size_t h = head;
+
+    if (Size - (h - tail) < sizeof(t) + sizeof(len) + len)
+    {
+        dropped++;
+        return;
+    }
+
+    write(h, &t, sizeof(t));
+    write(h + sizeof(t), &len, sizeof(len));
+    write(h + sizeof(t) + sizeof(len), prefix, strlen(prefix));
+    write(h + sizeof(t) + sizeof(len) + strlen(prefix), line.data(), line.size());
+
+    memory_barrier(); // The record must be complete before being published
+    head = h + sizeof(t) + sizeof(len) + len;
+  }
+
+  bool front(Time::point* t) const {
+
+    if (head == tail)
+        return false;
+
+    memory_barrier();
+    read(tail, t, sizeof(*t));
+    return true;
+  }
+
+  void pop(string& line) {
+
+    uint32_t len;
+    size_t t = tail;
+
+    read(t + sizeof(Time::point), &len, sizeof(len));
+    line.resize(len);
+
+    if (len)
+        read(t + sizeof(Time::point) + sizeof(len), &line[0], len);
+
+    memory_barrier(); // Done with the record before its space is released
+    tail = t + sizeof(Time::point) + sizeof(len) + len;
+  }
+};
+
 
 struct Tie: public streambuf { // MSVC requires splitted streambuf for cin and cout
 
-  Tie(streambuf* b, ofstream* f) : buf(b), file(f) {}
+  Tie(streambuf* b, const char* p, ConditionVariable* c) : buf(b), prefix(p), wakeUp(c) {
+    setp(area, area + sizeof(area));
+  }
 
-  int sync() { return file->rdbuf()->pubsync(), buf->pubsync(); }
-  int overflow(int c) { return log(buf->sputc((char)c), "<< "); }
+  int sync() { return forward(), buf->pubsync(); }
+  int overflow(int c) { return forward(), c == EOF ? 0 : sputc((char)c); }
   int underflow() { return buf->sgetc(); }
-  int uflow() { return log(buf->sbumpc(), ">> "); }
+  int uflow() { int c = buf->sbumpc(); if (c != EOF) log((char)c); return c; }
 
   streambuf* buf;
-  ofstream* file;
+  const char* prefix;
+  ConditionVariable* wakeUp;
+  LogRing ring;
+  size_t reported; // Dropped lines already reported by the writer
+  string line;
+  char area[1024]; // Output is passed to buf and logged in chunks
+
+  // Pass the buffered output to the tied streambuf and log it
+  void forward() {
+
+    buf->sputn(pbase(), pptr() - pbase());
+
+    for (const char* p = pbase(); p < pptr(); p++)
+        log(*p);
+
+    setp(area, area + sizeof(area));
+  }
 
-  int log(int c, const char* prefix) {
+  void log(char c) {
 
-    static int last = '\n';
+    if (c != '\n')
+    {
+        line += c;
+        return;
+    }
 
-    if (last == '\n')
-        file->rdbuf()->sputn(prefix, 3);
+    ring.push(Time::now(), prefix, line);
+    line.clear();
 
-    return last = file->rdbuf()->sputc((char)c);
+    if (ring.half_full())
+        wakeUp->notify_one();
   }
 };
 
 class Logger {
 
-  Logger() : in(cin.rdbuf(), &file), out(cout.rdbuf(), &file) {}
+  Logger() : in(cin.rdbuf(), ">> ", &sleepCond), out(cout.rdbuf(), "<< ", &sleepCond) {}
  ~Logger() { start(false); }
 
   ofstream file;
   Tie in, out;
+  Mutex mutex;
+  ConditionVariable sleepCond;
+  NativeHandle handle;
+  volatile bool exit;
+
+  // Write the lines queued by both Ties in timestamp order
+  void drain() {
+
+    Time::point ti = 0, to = 0;
+    bool hasIn = in.ring.front(&ti), hasOut = out.ring.front(&to);
+    string line;
+
+    while (hasIn || hasOut)
+    {
+        bool fromIn = hasIn && (!hasOut || ti <= to);
+        Time::point t = fromIn ? ti : to;
+        time_t sec = time_t(t / 1000);
+        char date[32];
+
+        strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", localtime(&sec));
+        (fromIn ? in : out).ring.pop(line);
+        file << date << "." << setfill('0') << setw(3) << t % 1000 << " " << line << "\n";
+
+        if (fromIn)
+            hasIn = in.ring.front(&ti);
+        else
+            hasOut = out.ring.front(&to);
+    }
+
+    Tie* ties[] = { &in, &out };
+
+    for (int i = 0; i < 2; i++)
+        if (ties[i]->ring.dropped != ties[i]->reported)
+        {
+            file << "(" << ties[i]->ring.dropped - ties[i]->reported
+                 << " lines dropped from " << (i ? "cout" : "cin") << ")\n";
+            ties[i]->reported = ties[i]->ring.dropped;
+        }
+
+    file.flush();
+  }
+
+  // The writer thread wakes up periodically, or when a ring is half full
+  static long writer(Logger* l) {
+
+    bool done;
+
+    do {
+        l->mutex.lock();
+
+        if (!l->exit)
+            l->sleepCond.wait_for(l->mutex, 100);
+
+        done = l->exit;
+        l->mutex.unlock();
+        l->drain();
+
+    } while (!done);
+
+    return 0;
+  }
 
 public:
   static void start(bool b) {
@@ -140,18 +332,39 @@ public:
     if (b && !l.file.is_open())
     {
         l.file.open("io_log.txt", ifstream::out | ifstream::app);
+        l.in.reported = l.in.ring.dropped;
+        l.out.reported = l.out.ring.dropped;
+        l.exit = false;
+
+        if (!thread_create(l.handle, writer, &l))
+        {
+            cerr << "Failed to create the log writer thread" << endl;
+            l.file.close();
+            return;
+        }
+
         cin.rdbuf(&l.in);
         cout.rdbuf(&l.out);
     }
     else if (!b && l.file.is_open())
     {
+        cout.flush();
         cout.rdbuf(l.out.buf);
         cin.rdbuf(l.in.buf);
+
+        l.mutex.lock();
+        l.exit = true;
+        l.sleepCond.notify_one();
+        l.mutex.unlock();
+
+        thread_join(l.handle);
         l.file.close();
     }
   }
 };
 
+} // namespace
+
 
 /// Used to serialize access to std::cout to avoid multiple threads to write at
 /// the same time.
@@ -199,6 +412,77 @@ int cpu_count() {
 }
 
 
+/// physical_memory() returns the size in bytes of the installed memory, or 0
+/// if it is not known.
+
+uint64_t physical_memory() {
+
+#if defined(_WIN32) || defined(_WIN64)
+  MEMORYSTATUSEX ms;
+  ms.dwLength = sizeof(ms);
+  return GlobalMemoryStatusEx(&ms) ? ms.ullTotalPhys : 0;
+#elif defined(_SC_PHYS_PAGES) && defined(_SC_PAGESIZE)
+  long pages = sysconf(_SC_PHYS_PAGES), pageSize = sysconf(_SC_PAGESIZE);
+  return pages > 0 && pageSize > 0 ? uint64_t(pages) * pageSize : 0;
+#else
+  return 0;
+#endif
+}
+
+
+/// cpu_features() returns the instruction set extensions of the running CPU
+/// as a mask of CpuFeature flags, or 0 when cpuid is not available.
+
+int cpu_features() {
+
+  int features = 0;
+
+#if defined(HAS_CPUID)
+  unsigned r[4], maxLeaf, family;
+  char vendor[13] = { 0 };
+
+#  if defined(_MSC_VER)
+#    define cpuid(leaf, r) __cpuidex((int*)(r), leaf, 0)
+#  else
+#    define cpuid(leaf, r) __cpuid_count(leaf, 0, r[0], r[1], r[2], r[3])
+#  endif
+
+  cpuid(0, r);
+  maxLeaf = r[0];
+  memcpy(vendor, &r[1], 4);
+  memcpy(vendor + 4, &r[3], 4);
+  memcpy(vendor + 8, &r[2], 4);
+
+  cpuid(1, r);
+  family = ((r[0] >> 8) & 0xF) + (((r[0] >> 8) & 0xF) == 0xF ? (r[0] >> 20) & 0xFF : 0);
+
+  if (r[2] & (1 << 23))
+      features |= CPU_POPCNT;
+
+  if (maxLeaf >= 7)
+  {
+      cpuid(7, r);
+
+      if (r[1] & (1 << 3))
+          features |= CPU_BMI1;
+
+      if (r[1] & (1 << 5))
+          features |= CPU_AVX2;
+
+      if (r[1] & (1 << 8))
+          features |= CPU_BMI2;
+  }
+
+  if ((features & CPU_BMI2) && !strcmp(vendor, "AuthenticAMD") && family < 0x19)
+      features |= CPU_SLOW_PEXT;
+
+#  undef cpuid
+#endif
+
+  return features;
+}
+
+
 /// timed_wait() waits for msec milliseconds. It is mainly an helper to wrap
 /// conversion from milliseconds to struct timespec, as used by pthreads.
 
@@ -218,6 +502,60 @@ void timed_wait(WaitCondition& sleepCond, Lock& sleepLock, int msec) {
 }
 
 
+/// map_file() maps the whole file read-only in memory and returns its address
+/// and size, or NULL if the file cannot be opened or is empty. The mapping
+/// stays valid until unmap_file(), the file itself is not kept open.
+
+const void* map_file(const string& fName, uint64_t* size) {
+
+  void* base;
+
+#if !defined(_WIN32) && !defined(_WIN64)
+  int fd = open(fName.c_str(), O_RDONLY);
+
+  if (fd == -1)
+      return NULL;
+
+  struct stat st;
+  fstat(fd, &st);
+  *size = st.st_size;
+  base = *size ? mmap(NULL, *size, PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+  close(fd);
+
+  return base == MAP_FAILED ? NULL : base;
+#else
+  HANDLE fd = CreateFileA(fName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                          OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+
+  if (fd == INVALID_HANDLE_VALUE)
+      return NULL;
+
+  DWORD hi, lo = GetFileSize(fd, &hi);
+  HANDLE mmap = (lo || hi) ? CreateFileMapping(fd, NULL, PAGE_READONLY, hi, lo, NULL) : NULL;
+  CloseHandle(fd);
+
+  if (!mmap)
+      return NULL;
+
+  *size = (uint64_t(hi) << 32) | lo;
+  base = MapViewOfFile(mmap, FILE_MAP_READ, 0, 0, 0);
+  CloseHandle(mmap); // The view keeps the mapping alive
+
+  return base;
+#endif
+}
+
+void unmap_file(const void* base, uint64_t size) {
+
+#if !defined(_WIN32) && !defined(_WIN64)
+  munmap(const_cast<void*>(base), size);
+#else
+  (void)size;
+  UnmapViewOfFile(base);
+#endif
+}
+
+
 /// prefetch() preloads the given address in L1/L2 cache. This is a non
 /// blocking function and do not stalls the CPU waiting for data to be
 /// loaded from memory, that can be quite slow.
@@ -20,7 +20,6 @@
 #if !defined(MISC_H_INCLUDED)
 #define MISC_H_INCLUDED
 
-#include <fstream>
 #include <string>
 #include <vector>
 
@@ -28,8 +27,12 @@
 
 extern const std::string engine_info(bool to_uci = false);
 extern int cpu_count();
+extern uint64_t physical_memory();
+extern int cpu_features();
 extern void timed_wait(WaitCondition&, Lock&, int);
 extern void prefetch(char* addr);
+extern const void* map_file(const std::string& fName, uint64_t* size);
+extern void unmap_file(const void* base, uint64_t size);
 extern void start_logger(bool b);
 
 extern void dbg_hit_on(bool b);
@@ -38,15 +41,36 @@ extern void dbg_mean_of(int v);
 extern void dbg_print();
 
 
-struct Log : public std::ofstream {
-  Log(const std::string& f = "log.txt") : std::ofstream(f.c_str(), std::ios::out | std::ios::app) {}
- ~Log() { if (is_open()) close(); }
+/// Instruction set extensions reported by cpu_features(). CPU_SLOW_PEXT flags
+/// the AMD CPUs before Zen 3, where pext is microcoded and slower than magics.
+enum CpuFeature {
+  CPU_POPCNT = 1, CPU_BMI1 = 2, CPU_BMI2 = 4, CPU_AVX2 = 8, CPU_SLOW_PEXT = 16
 };
 
 
 namespace Time {
   typedef int64_t point;
   point now();
+  int64_t now_us(); // Microseconds, for short intervals
+}
+
+
+/// get_le() and put_le() read and write an integer in little-endian byte
+/// order, for the binary formats that must not depend on the host.
+
+template<typename T> inline T get_le(const unsigned char* p) {
+
+  T n = 0;
+  for (int i = sizeof(T) - 1; i >= 0; i--)
+      n = T((n << 8) | p[i]);
+
+  return n;
+}
+
+template<typename T> inline void put_le(unsigned char* p, T n) {
+
+  for (size_t i = 0; i < sizeof(T); i++)
+      p[i] = (unsigned char)(uint64_t(n) >> (8 * i));
 }
 
 
@@ -90,10 +90,10 @@ namespace {
     {
         Square to = pop_lsb(&b);
 
-        if (Type == CAPTURES || Type == EVASIONS || Type == NON_EVASIONS)
+        if (Type == CAPTURES || Type == EVASIONS || Type == NON_EVASIONS || Type == LEGAL)
             (*mlist++).move = make<PROMOTION>(to - Delta, to, QUEEN);
 
-        if (Type == QUIETS || Type == EVASIONS || Type == NON_EVASIONS)
+        if (Type == QUIETS || Type == EVASIONS || Type == NON_EVASIONS || Type == LEGAL)
         {
             (*mlist++).move = make<PROMOTION>(to - Delta, to, ROOK);
             (*mlist++).move = make<PROMOTION>(to - Delta, to, BISHOP);
@@ -112,8 +112,12 @@ namespace {
   }
 
 
+  // generate_pawn_moves() generates the moves of the given pawns. With LEGAL,
+  // used by generate_legal(), the moves are restricted to 'target' as for the
+  // evasions and the en-passant captures are left to the caller.
+
   template<Color Us, GenType Type>
-  MoveStack* generate_pawn_moves(const Position& pos, MoveStack* mlist,
+  MoveStack* generate_pawn_moves(const Position& pos, MoveStack* mlist, Bitboard pawns,
                                  Bitboard target, const CheckInfo* ci) {
 
     // Compute our parametrized parameters at compile time, named according to
@@ -128,10 +132,10 @@ namespace {
 
     Bitboard b1, b2, dc1, dc2, emptySquares;
 
-    Bitboard pawnsOn7    = pos.pieces(Us, PAWN) &  TRank7BB;
-    Bitboard pawnsNotOn7 = pos.pieces(Us, PAWN) & ~TRank7BB;
+    Bitboard pawnsOn7    = pawns &  TRank7BB;
+    Bitboard pawnsNotOn7 = pawns & ~TRank7BB;
 
-    Bitboard enemies = (Type == EVASIONS ? pos.pieces(Them) & target:
+    Bitboard enemies = (Type == EVASIONS || Type == LEGAL ? pos.pieces(Them) & target:
                         Type == CAPTURES ? target : pos.pieces(Them));
 
     // Single and double pawn pushes, no promotions
@@ -142,7 +146,7 @@ namespace {
         b1 = move_pawns<UP>(pawnsNotOn7)   & emptySquares;
         b2 = move_pawns<UP>(b1 & TRank3BB) & emptySquares;
 
-        if (Type == EVASIONS) // Consider only blocking squares
+        if (Type == EVASIONS || Type == LEGAL) // Consider only blocking squares
         {
             b1 &= target;
             b2 &= target;
@@ -177,7 +181,7 @@ namespace {
         if (Type == CAPTURES)
             emptySquares = ~pos.pieces();
 
-        if (Type == EVASIONS)
+        if (Type == EVASIONS || Type == LEGAL)
             emptySquares &= target;
 
         mlist = generate_promotions<Type, RIGHT>(mlist, pawnsOn7, enemies, ci);
@@ -186,7 +190,7 @@ namespace {
     }
 
     // Standard and en-passant captures
-    if (Type == CAPTURES || Type == EVASIONS || Type == NON_EVASIONS)
+    if (Type == CAPTURES || Type == EVASIONS || Type == NON_EVASIONS || Type == LEGAL)
     {
         b1 = move_pawns<RIGHT>(pawnsNotOn7) & enemies;
         b2 = move_pawns<LEFT >(pawnsNotOn7) & enemies;
@@ -194,7 +198,7 @@ namespace {
         SERIALIZE_PAWNS(b1, RIGHT);
         SERIALIZE_PAWNS(b2, LEFT);
 
-        if (pos.ep_square() != SQ_NONE)
+        if (Type != LEGAL && pos.ep_square() != SQ_NONE)
         {
             assert(rank_of(pos.ep_square()) == relative_rank(Us, RANK_6));
 
@@ -262,8 +266,8 @@ namespace {
   MoveStack* generate_all_moves(const Position& pos, MoveStack* mlist, Color us,
                                 Bitboard target, const CheckInfo* ci = NULL) {
 
-    mlist = (us == WHITE ? generate_pawn_moves<WHITE, Type>(pos, mlist, target, ci)
-                         : generate_pawn_moves<BLACK, Type>(pos, mlist, target, ci));
+    mlist = (us == WHITE ? generate_pawn_moves<WHITE, Type>(pos, mlist, pos.pieces(us, PAWN), target, ci)
+                         : generate_pawn_moves<BLACK, Type>(pos, mlist, pos.pieces(us, PAWN), target, ci));
 
     mlist = generate_moves<KNIGHT, Type == QUIET_CHECKS>(pos, mlist, us, target, ci);
     mlist = generate_moves<BISHOP, Type == QUIET_CHECKS>(pos, mlist, us, target, ci);
@@ -291,6 +295,136 @@ namespace {
   }
 
 
+  // generate_legal_moves() generates the moves of the pieces of type Pt, a
+  // pinned piece can move only along the ray from the king through its square.
+
+  template<PieceType Pt> FORCE_INLINE
+  MoveStack* generate_legal_moves(const Position& pos, MoveStack* mlist, Color us,
+                                  Bitboard target, Bitboard pinned, Square ksq) {
+
+    const Square* pl = pos.piece_list(us, Pt);
+
+    for (Square from = *pl; from != SQ_NONE; from = *++pl)
+    {
+        Bitboard b = pos.attacks_from<Pt>(from) & target;
+
+        if (pinned & from)
+            b &= ray_bb(ksq, from);
+
+        SERIALIZE(b);
+    }
+
+    return mlist;
+  }
+
+
+  // generate_legal_king_moves() generates the king moves to the squares that
+  // are not attacked with the king removed from the board, so that it can not
+  // escape along the line of a slider.
+
+  template<Color Us> FORCE_INLINE
+  MoveStack* generate_legal_king_moves(const Position& pos, MoveStack* mlist) {
+
+    const Color Them = (Us == WHITE ? BLACK : WHITE);
+
+    Square from = pos.king_square(Us);
+    Bitboard occupied = pos.pieces() ^ from;
+    Bitboard b = pos.attacks_from<KING>(from) & ~pos.pieces(Us);
+
+    while (b)
+    {
+        Square to = pop_lsb(&b);
+
+        if (!(pos.attackers_to(to, occupied) & pos.pieces(Them)))
+            (*mlist++).move = make_move(from, to);
+    }
+
+    return mlist;
+  }
+
+
+  // generate_legal() generates only legal moves, so that no legality test of
+  // the single moves is needed. When in check the target of the non king moves
+  // is the check mask, the checker and the squares in between, and the pinned
+  // pieces are restricted to their pin ray. Only en-passant captures, that can
+  // uncover an attack along the rank of the king, still need the full test.
+  // Moves are in the same order of the pseudo-legal generators.
+
+  template<Color Us>
+  MoveStack* generate_legal(const Position& pos, MoveStack* mlist) {
+
+    const Color  Them = (Us == WHITE ? BLACK   : WHITE);
+    const Square UP   = (Us == WHITE ? DELTA_N : DELTA_S);
+
+    Square ksq = pos.king_square(Us);
+    Square to = pos.ep_square();
+    Bitboard checkers = pos.checkers();
+    Bitboard pinned = pos.pinned_pieces();
+    Bitboard b, target;
+
+    if (checkers)
+    {
+        mlist = generate_legal_king_moves<Us>(pos, mlist);
+
+        if (more_than_one(checkers))
+            return mlist; // Double check, only a king move can save the day
+
+        target = (between_bb(ksq, lsb(checkers)) | checkers);
+    }
+    else
+        target = ~pos.pieces(Us);
+
+    b = pos.pieces(Us, PAWN) & pinned;
+    mlist = generate_pawn_moves<Us, LEGAL>(pos, mlist, pos.pieces(Us, PAWN) & ~pinned, target, NULL);
+
+    while (b)
+    {
+        Square from = pop_lsb(&b);
+        mlist = generate_pawn_moves<Us, LEGAL>(pos, mlist, SquareBB[from], target & ray_bb(ksq, from), NULL);
+    }
+
+    // An en-passant capture must capture the checker or block the check
+    if (to != SQ_NONE && (target & (SquareBB[to] | SquareBB[to - UP])))
+    {
+        b = pos.pieces(Us, PAWN) & pos.attacks_from<PAWN>(to, Them);
+
+        while (b)
+        {
+            Move m = make<ENPASSANT>(pop_lsb(&b), to);
+
+            if (pos.pl_move_is_legal(m, pinned))
+                (*mlist++).move = m;
+        }
+    }
+
+    mlist = generate_legal_moves<KNIGHT>(pos, mlist, Us, target, pinned, ksq);
+    mlist = generate_legal_moves<BISHOP>(pos, mlist, Us, target, pinned, ksq);
+    mlist = generate_legal_moves<ROOK>(pos, mlist, Us, target, pinned, ksq);
+    mlist = generate_legal_moves<QUEEN>(pos, mlist, Us, target, pinned, ksq);
+
+    if (checkers)
+        return mlist;
+
+    mlist = generate_legal_king_moves<Us>(pos, mlist);
+
+    if (pos.can_castle(Us))
+    {
+        if (pos.is_chess960())
+        {
+            mlist = generate_castle<KING_SIDE,  false, true>(pos, mlist, Us);
+            mlist = generate_castle<QUEEN_SIDE, false, true>(pos, mlist, Us);
+        }
+        else
+        {
+            mlist = generate_castle<KING_SIDE,  false, false>(pos, mlist, Us);
+            mlist = generate_castle<QUEEN_SIDE, false, false>(pos, mlist, Us);
+        }
+    }
+
+    return mlist;
+  }
+
+
 } // namespace
 
 
@@ -428,18 +562,6 @@ MoveStack* generate<EVASIONS>(const Position& pos, MoveStack* mlist) {
 template<>
 MoveStack* generate<LEGAL>(const Position& pos, MoveStack* mlist) {
 
-  MoveStack *end, *cur = mlist;
-  Bitboard pinned = pos.pinned_pieces();
-  Square ksq = pos.king_square(pos.side_to_move());
-
-  end = pos.in_check() ? generate<EVASIONS>(pos, mlist)
-                       : generate<NON_EVASIONS>(pos, mlist);
-  while (cur != end)
-      if (   (pinned || from_sq(cur->move) == ksq || type_of(cur->move) == ENPASSANT)
-          && !pos.pl_move_is_legal(cur->move, pinned))
-          cur->move = (--end)->move;
-      else
-          cur++;
-
-  return end;
+  return pos.side_to_move() == WHITE ? generate_legal<WHITE>(pos, mlist)
+                                     : generate_legal<BLACK>(pos, mlist);
 }
@@ -97,6 +97,85 @@ Move move_from_uci(const Position& pos, string& str) {
 }
 
 
+/// move_from_san() takes a position and a string representing a move in short
+/// algebraic notation (Nbd7, exd8=Q+, O-O, etc.) and returns an equivalent legal
+/// Move if any. Check and annotation suffixes are ignored, as are 'x' and '-'.
+
+Move move_from_san(const Position& pos, string& str) {
+
+  string san = str.substr(0, str.find_first_of("+#!?"));
+
+  if (san == "O-O" || san == "0-0" || san == "O-O-O" || san == "0-0-0")
+  {
+      for (MoveList<LEGAL> ml(pos); !ml.end(); ++ml)
+          if (   type_of(ml.move()) == CASTLE
+              && (to_sq(ml.move()) > from_sq(ml.move())) == (san.length() == 3))
+              return ml.move();
+
+      return MOVE_NONE;
+  }
+
+  PieceType pt = PAWN, promotion = NO_PIECE_TYPE;
+  string chars;
+
+  for (size_t i = 0; i < san.length(); i++)
+  {
+      char c = san[i];
+      size_t idx = string(PieceToChar).find(c);
+
+      if (c == 'x' || c == '-' || c == '=')
+          continue;
+
+      else if (idx >= PAWN && idx <= KING && i == 0)
+          pt = PieceType(idx);
+
+      else if (idx >= KNIGHT && idx <= QUEEN && i == san.length() - 1)
+          promotion = PieceType(idx);
+
+      else if ((c >= 'a' && c <= 'h') || (c >= '1' && c <= '8'))
+          chars += c;
+
+      else
+          return MOVE_NONE;
+  }
+
+  // The last two chars are the destination square, any before disambiguate
+  if (chars.length() < 2 || chars.length() > 4)
+      return MOVE_NONE;
+
+  Square to = File(chars[chars.length() - 2] - 'a') | Rank(chars[chars.length() - 1] - '1');
+  string from = chars.substr(0, chars.length() - 2);
+  Move move = MOVE_NONE;
+
+  for (MoveList<LEGAL> ml(pos); !ml.end(); ++ml)
+  {
+      Move m = ml.move();
+      Square s = from_sq(m);
+
+      if (   to_sq(m) != to
+          || type_of(m) == CASTLE
+          || type_of(pos.piece_on(s)) != pt
+          || (type_of(m) == PROMOTION ? promotion_type(m) : NO_PIECE_TYPE) != promotion)
+          continue;
+
+      bool matched = true;
+
+      for (size_t i = 0; i < from.length(); i++)
+          matched &= from[i] == (isdigit(from[i]) ? rank_to_char(rank_of(s)) : file_to_char(file_of(s)));
+
+      if (!matched)
+          continue;
+
+      if (move) // Ambiguous
+          return MOVE_NONE;
+
+      move = m;
+  }
+
+  return move;
+}
+
+
 /// move_to_san() takes a position and a legal Move as input and returns its
 /// short algebraic notation representation.
 
@@ -221,7 +300,7 @@ static string score_to_string(Value v) {
   return s.str();
 }
 
-string pretty_pv(Position& pos, int depth, Value value, int64_t msecs, Move pv[]) {
+string pretty_pv(Position& pos, int depth, Value value, int64_t msecs, int64_t nodes, Move pv[]) {
 
   const int64_t K = 1000;
   const int64_t M = 1000000;
@@ -236,14 +315,14 @@ string pretty_pv(Position& pos, int depth, Value value, int64_t msecs, Move pv[]
     << setw(8) << score_to_string(value)
     << setw(8) << time_to_string(msecs);
 
-  if (pos.nodes_searched() < M)
-      s << setw(8) << pos.nodes_searched() / 1 << "  ";
+  if (nodes < M)
+      s << setw(8) << nodes / 1 << "  ";
 
-  else if (pos.nodes_searched() < K * M)
-      s << setw(7) << pos.nodes_searched() / K << "K  ";
+  else if (nodes < K * M)
+      s << setw(7) << nodes / K << "K  ";
 
   else
-      s << setw(7) << pos.nodes_searched() / M << "M  ";
+      s << setw(7) << nodes / M << "M  ";
 
   padding = string(s.str().length(), ' ');
   length = padding.length();
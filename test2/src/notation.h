@@ -28,8 +28,9 @@ class Position;
 
 std::string score_to_uci(Value v, Value alpha = -VALUE_INFINITE, Value beta = VALUE_INFINITE);
 Move move_from_uci(const Position& pos, std::string& str);
+Move move_from_san(const Position& pos, std::string& str);
 const std::string move_to_uci(Move m, bool chess960);
 const std::string move_to_san(Position& pos, Move m);
-std::string pretty_pv(Position& pos, int depth, Value score, int64_t msecs, Move pv[]);
+std::string pretty_pv(Position& pos, int depth, Value score, int64_t msecs, int64_t nodes, Move pv[]);
 
 #endif // !defined(NOTATION_H_INCLUDED)
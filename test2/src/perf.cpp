@@ -0,0 +1,189 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2012 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "perf.h"
+
+#if defined(__linux__)
+#  include <dirent.h>
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+namespace {
+
+  const char* EventNames[] = {
+    "cycles", "instructions", "cache references", "cache misses", "L1d misses", "branch misses"
+  };
+
+#if defined(__linux__)
+
+  // Type and configuration of each event for perf_event_attr
+  const uint32_t EventTypes[] = {
+    PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+    PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE
+  };
+
+  const uint64_t EventConfigs[] = {
+    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_REFERENCES,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+    PERF_COUNT_HW_BRANCH_MISSES
+  };
+
+  // open_counter() opens a disabled counter of user space events for thread
+  // 'tid', on any cpu. Returns -1 on failure.
+  int open_counter(int tid, PerfCounters::Event e) {
+
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = EventTypes[e];
+    attr.config = EventConfigs[e];
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return int(syscall(__NR_perf_event_open, &attr, tid, -1, -1, 0));
+  }
+
+  // thread_ids() returns the kernel ids of the running threads of the process
+  std::vector<int> thread_ids() {
+
+    std::vector<int> tids;
+    DIR* dir = opendir("/proc/self/task");
+
+    if (!dir)
+        return tids;
+
+    while (dirent* ent = readdir(dir))
+        if (ent->d_name[0] != '.')
+            tids.push_back(atoi(ent->d_name));
+
+    closedir(dir);
+    return tids;
+  }
+
+#endif
+
+} // namespace
+
+
+PerfCounters::PerfCounters() {
+
+  std::fill(values, values + EVENT_NB, -1);
+}
+
+PerfCounters::~PerfCounters() { close_all(); }
+
+
+/// PerfCounters::name() returns a printable name of the event
+
+const char* PerfCounters::name(Event e) {
+
+  return EventNames[e];
+}
+
+
+/// PerfCounters::start() opens the counters on the threads of the process and
+/// starts counting. Threads should not be created or destroyed until stop().
+
+void PerfCounters::start() {
+
+  close_all();
+
+#if defined(__linux__)
+  std::vector<int> tids = thread_ids();
+
+  for (int e = 0; e < EVENT_NB; e++)
+      for (size_t i = 0; i < tids.size(); i++)
+      {
+          int fd = open_counter(tids[i], Event(e));
+
+          if (fd < 0) // An event is counted on all the threads or not at all
+          {
+              for (size_t j = 0; j < fds[e].size(); j++)
+                  close(fds[e][j]);
+
+              fds[e].clear();
+              break;
+          }
+          fds[e].push_back(fd);
+      }
+
+  for (int e = 0; e < EVENT_NB; e++)
+      for (size_t i = 0; i < fds[e].size(); i++)
+          ioctl(fds[e][i], PERF_EVENT_IOC_ENABLE, 0);
+#endif
+}
+
+
+/// PerfCounters::stop() stops counting and sums up the counts of all the
+/// threads. Counts are scaled when the kernel had to multiplex the counters.
+
+void PerfCounters::stop() {
+
+  std::fill(values, values + EVENT_NB, -1);
+
+#if defined(__linux__)
+  for (int e = 0; e < EVENT_NB; e++)
+      for (size_t i = 0; i < fds[e].size(); i++)
+          ioctl(fds[e][i], PERF_EVENT_IOC_DISABLE, 0);
+
+  for (int e = 0; e < EVENT_NB; e++)
+  {
+      if (fds[e].empty())
+          continue;
+
+      double sum = 0;
+
+      for (size_t i = 0; i < fds[e].size(); i++)
+      {
+          uint64_t data[3]; // Value, time enabled, time running
+
+          if (read(fds[e][i], data, sizeof(data)) == sizeof(data) && data[2])
+              sum += double(data[0]) * data[1] / data[2];
+      }
+
+      values[e] = int64_t(sum);
+  }
+#endif
+
+  close_all();
+}
+
+
+void PerfCounters::close_all() {
+
+  for (int e = 0; e < EVENT_NB; e++)
+  {
+#if defined(__linux__)
+      for (size_t i = 0; i < fds[e].size(); i++)
+          close(fds[e][i]);
+#endif
+      fds[e].clear();
+  }
+}
@@ -0,0 +1,55 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2012 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#if !defined(PERF_H_INCLUDED)
+#define PERF_H_INCLUDED
+
+#include <vector>
+
+#include "types.h"
+
+/// PerfCounters counts hardware events over all the threads of the process,
+/// through the Linux perf_event_open() interface. On other systems, or when
+/// the kernel or the hypervisor does not expose the hardware counters, an
+/// event can not be counted and available() returns false for it.
+
+class PerfCounters {
+public:
+  enum Event {
+    CYCLES, INSTRUCTIONS, CACHE_REFERENCES, CACHE_MISSES, L1D_MISSES, BRANCH_MISSES,
+    EVENT_NB
+  };
+
+  PerfCounters();
+ ~PerfCounters();
+  void start();
+  void stop();
+  bool available(Event e) const { return values[e] >= 0; }
+  int64_t value(Event e) const { return values[e]; }
+  static const char* name(Event e);
+
+private:
+  void close_all();
+
+  std::vector<int> fds[EVENT_NB]; // One per thread
+  int64_t values[EVENT_NB];
+};
+
+#endif // !defined(PERF_H_INCLUDED)
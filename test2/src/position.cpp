@@ -290,6 +290,7 @@ void Position::from_fen(const string& fenStr, bool isChess960, Thread* th) {
   st->psqScore = compute_psq_score();
   st->npMaterial[WHITE] = compute_non_pawn_material(WHITE);
   st->npMaterial[BLACK] = compute_non_pawn_material(BLACK);
+  key_count(st->key)++;
   st->checkersBB = attackers_to(king_square(sideToMove)) & pieces(~sideToMove);
   chess960 = isChess960;
   thisThread = th;
@@ -791,6 +792,7 @@ void Position::do_move(Move m, StateInfo& newSt, const CheckInfo& ci, bool moveI
   {
       st->key = k;
       do_castle_move<true>(m);
+      key_count(st->key)++;
       return;
   }
 
@@ -948,9 +950,11 @@ void Position::do_move(Move m, StateInfo& newSt, const CheckInfo& ci, bool moveI
       st->rule50 = 0;
   }
 
-  // Prefetch pawn and material hash tables
-  prefetch((char*)thisThread->pawnTable.entries[st->pawnKey]);
-  prefetch((char*)thisThread->materialTable.entries[st->materialKey]);
+  // Prefetch pawn hash table, material is almost always directly indexed.
+  // Positions that are never evaluated, as in the perft and book building
+  // helper threads, have no owner thread and no tables.
+  if (thisThread)
+      prefetch((char*)thisThread->pawnTable.entries[st->pawnKey]);
 
   // Update incremental scores
   st->psqScore += psq_delta(piece, from, to);
@@ -960,6 +964,7 @@ void Position::do_move(Move m, StateInfo& newSt, const CheckInfo& ci, bool moveI
 
   // Update the key with the final value
   st->key = k;
+  key_count(k)++;
 
   // Update checkers bitboard, piece must be already moved
   st->checkersBB = 0;
@@ -998,7 +1003,9 @@ void Position::do_move(Move m, StateInfo& newSt, const CheckInfo& ci, bool moveI
 void Position::undo_move(Move m) {
 
   assert(is_ok(m));
+  assert(key_count(st->key) > 0);
 
+  key_count(st->key)--;
   sideToMove = ~sideToMove;
 
   if (type_of(m) == CASTLE)
@@ -1201,6 +1208,9 @@ void Position::do_null_move(StateInfo& backupSt) {
   StateInfo* src = Do ? st : &backupSt;
   StateInfo* dst = Do ? &backupSt : st;
 
+  if (!Do)
+      key_count(st->key)--;
+
   dst->key      = src->key;
   dst->epSquare = src->epSquare;
   dst->psqScore = src->psqScore;
@@ -1220,6 +1230,7 @@ void Position::do_null_move(StateInfo& backupSt) {
       st->epSquare = SQ_NONE;
       st->rule50++;
       st->pliesFromNull = 0;
+      key_count(st->key)++;
   }
 
   assert(pos_is_ok());
@@ -1484,8 +1495,10 @@ bool Position::is_draw() const {
   if (st->rule50 > 99 && (!in_check() || MoveList<LEGAL>(*this).size()))
       return true;
 
-  // Draw by repetition?
-  if (!SkipRepetition)
+  // Draw by repetition? The key of the current position is always counted,
+  // so if no other position along the path falls in the same key slot then
+  // there cannot be a repetition and we can skip walking the previous states.
+  if (!SkipRepetition && key_count(st->key) > 1)
   {
       int i = 4, e = std::min(st->rule50, st->pliesFromNull);
 
@@ -1552,6 +1565,7 @@ void Position::flip() {
   st->psqScore = compute_psq_score();
   st->npMaterial[WHITE] = compute_non_pawn_material(WHITE);
   st->npMaterial[BLACK] = compute_non_pawn_material(BLACK);
+  key_count(st->key)++;
 
   assert(pos_is_ok());
 }
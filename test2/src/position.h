@@ -60,6 +60,8 @@ struct StateInfo {
   StateInfo* previous;
 };
 
+const int KeyCountSize = 1024; // Must be a power of 2
+
 struct ReducedStateInfo {
   Key pawnKey, materialKey;
   Value npMaterial[2];
@@ -88,8 +90,11 @@ struct ReducedStateInfo {
 ///    * Hash keys for the position itself, the current pawn structure, and
 ///      the current material situation.
 ///    * Hash keys for all previous positions in the game for detecting
-///      repetition draws.
+///      repetition draws, plus a small table counting them by hash slot so
+///      that most nodes can skip the walk through the previous states.
 ///    * A counter for detecting 50 move rule draws.
+///    * The thread whose pawn and material tables the evaluation uses. It can
+///      be NULL for a position that is only used to make moves.
 
 class Position {
 public:
@@ -179,6 +184,7 @@ public:
   // Other properties of the position
   Color side_to_move() const;
   int startpos_ply_counter() const;
+  int rule50_count() const;
   bool is_chess960() const;
   Thread* this_thread() const;
   int64_t nodes_searched() const;
@@ -208,6 +214,10 @@ private:
   Score compute_psq_score() const;
   Value compute_non_pawn_material(Color c) const;
 
+  // Counter of the positions along the game and search path with a given key slot
+  uint16_t& key_count(Key k);
+  uint16_t key_count(Key k) const;
+
   // Board and pieces
   Piece board[64];             // [square]
   Bitboard byTypeBB[8];        // [pieceType]
@@ -227,6 +237,7 @@ private:
   Thread* thisThread;
   StateInfo* st;
   int chess960;
+  uint16_t keyCount[KeyCountSize];
 };
 
 inline int64_t Position::nodes_searched() const {
@@ -237,6 +248,14 @@ inline void Position::set_nodes_searched(int64_t n) {
   nodes = n;
 }
 
+inline uint16_t& Position::key_count(Key k) {
+  return keyCount[(k >> 32) & (KeyCountSize - 1)];
+}
+
+inline uint16_t Position::key_count(Key k) const {
+  return keyCount[(k >> 32) & (KeyCountSize - 1)];
+}
+
 inline Piece Position::piece_on(Square s) const {
   return board[s];
 }
@@ -388,6 +407,10 @@ inline int Position::startpos_ply_counter() const {
   return startPosPly + st->pliesFromNull; // HACK
 }
 
+inline int Position::rule50_count() const {
+  return st->rule50;
+}
+
 inline bool Position::opposite_bishops() const {
 
   return   pieceCount[WHITE][BISHOP] == 1
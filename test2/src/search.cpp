@@ -24,6 +24,7 @@
 #include <iostream>
 #include <sstream>
 
+#include "bitcount.h"
 #include "book.h"
 #include "evaluate.h"
 #include "history.h"
@@ -31,6 +32,8 @@
 #include "movepick.h"
 #include "notation.h"
 #include "search.h"
+#include "searchlog.h"
+#include "tablebase.h"
 #include "timeman.h"
 #include "thread.h"
 #include "tt.h"
@@ -44,6 +47,8 @@ namespace Search {
   Position RootPosition;
   Time::point SearchTime;
   StateStackPtr SetupStates;
+  int CompletedDepth;
+  std::vector<IterationInfo> Iterations;
 }
 
 using std::string;
@@ -119,7 +124,7 @@ namespace {
   TimeManager TimeMgr;
   int BestMoveChanges;
   int SkillLevel;
-  bool SkillLevelEnabled, Chess960;
+  bool SkillLevelEnabled, Chess960, UseSearchLog;
   History H;
 
 
@@ -232,6 +237,8 @@ void Search::think() {
   TimeMgr.init(Limits, pos.startpos_ply_counter(), pos.side_to_move());
   TT.new_search();
   H.clear();
+  CompletedDepth = 0;
+  Iterations.clear();
 
   if (RootMoves.empty())
   {
@@ -261,17 +268,10 @@ void Search::think() {
   SkillLevelEnabled = (SkillLevel < 20);
   MultiPV = (SkillLevelEnabled ? std::max(UCIMultiPV, (size_t)4) : UCIMultiPV);
 
-  if (Options["Use Search Log"])
-  {
-      Log log(Options["Search Log Filename"]);
-      log << "\nSearching: "  << pos.to_fen()
-          << "\ninfinite: "   << Limits.infinite
-          << " ponder: "      << Limits.ponder
-          << " time: "        << Limits.time[pos.side_to_move()]
-          << " increment: "   << Limits.inc[pos.side_to_move()]
-          << " moves to go: " << Limits.movestogo
-          << std::endl;
-  }
+  UseSearchLog = Options["Use Search Log"];
+
+  if (UseSearchLog)
+      SearchLog::search_started(Options["Search Log Filename"], pos, Limits);
 
   Threads.wake_up();
 
@@ -288,20 +288,9 @@ void Search::think() {
   Threads.set_timer(0); // Stop timer
   Threads.sleep();
 
-  if (Options["Use Search Log"])
-  {
-      Time::point elapsed = Time::now() - SearchTime + 1;
-
-      Log log(Options["Search Log Filename"]);
-      log << "Nodes: "          << pos.nodes_searched()
-          << "\nNodes/second: " << pos.nodes_searched() * 1000 / elapsed
-          << "\nBest move: "    << move_to_san(pos, RootMoves[0].pv[0]);
-
-      StateInfo st;
-      pos.do_move(RootMoves[0].pv[0], st);
-      log << "\nPonder move: " << move_to_san(pos, RootMoves[0].pv[1]) << std::endl;
-      pos.undo_move(RootMoves[0].pv[0]);
-  }
+  if (UseSearchLog)
+      SearchLog::search_done(Time::now() - SearchTime + 1, pos.nodes_searched(),
+                             RootMoves[0].pv[0], RootMoves[0].pv[1]);
 
 finalize:
 
@@ -431,16 +420,21 @@ namespace {
             }
         }
 
+        if (!Signals.stop)
+        {
+            IterationInfo info = { depth, Time::now() - SearchTime,
+                                   RootMoves[0].pv[0], RootMoves[0].score };
+            CompletedDepth = depth;
+            Iterations.push_back(info);
+        }
+
         // Skills: Do we need to pick now the best move ?
         if (SkillLevelEnabled && depth == 1 + SkillLevel)
             skillBest = do_skill_level();
 
-        if (!Signals.stop && Options["Use Search Log"])
-        {
-            Log log(Options["Search Log Filename"]);
-            log << pretty_pv(pos, depth, bestValue, Time::now() - SearchTime, &RootMoves[0].pv[0])
-                << std::endl;
-        }
+        if (!Signals.stop && UseSearchLog)
+            SearchLog::iteration_done(depth, bestValue, Time::now() - SearchTime,
+                                      pos.nodes_searched(), RootMoves[0].pv);
 
         // Filter out startup noise when monitoring best move stability
         if (depth > 2 && BestMoveChanges)
@@ -564,6 +558,7 @@ namespace {
         ss->currentMove = threatMove = (ss+1)->excludedMove = bestMove = MOVE_NONE;
         (ss+1)->skipNullMove = false; (ss+1)->reduction = DEPTH_ZERO;
         (ss+2)->killers[0] = (ss+2)->killers[1] = MOVE_NONE;
+        STAT_INC(thisThread, SEARCH_NODES);
 
     }
 
@@ -600,6 +595,13 @@ namespace {
     ttMove = RootNode ? RootMoves[PVIdx].pv[0] : tte ? tte->move() : MOVE_NONE;
     ttValue = tte ? value_from_tt(tte->value(), ss->ply) : VALUE_ZERO;
 
+    thisThread->ttProbes++;
+    thisThread->ttHits += (tte != NULL);
+
+    STAT_INC(thisThread, TT_PROBES);
+    if (tte)
+        STAT_INC(thisThread, TT_HITS);
+
     // At PV nodes we check for exact scores, while at non-PV nodes we check for
     // a fail high/low. Biggest advantage at probing at PV nodes is to have a
     // smooth experience in analysis mode. We don't probe at Root nodes otherwise
@@ -607,6 +609,7 @@ namespace {
     if (!RootNode && tte && (PvNode ? tte->depth() >= depth && tte->type() == BOUND_EXACT
                                     : can_return_tt(tte, depth, ttValue, beta)))
     {
+        STAT_INC(thisThread, TT_CUTOFFS);
         TT.refresh(tte);
         ss->currentMove = ttMove; // Can be MOVE_NONE
 
@@ -621,13 +624,34 @@ namespace {
         return ttValue;
     }
 
+    // Step 4a. Tablebase probe. Probed only after a capture or a pawn move, the
+    // tables ignore the 50 moves rule. A win is scored just below the mate
+    // scores, so that a real mate is still preferred. The probe is cheap, so the
+    // result is not stored in TT (entries would lack a static evaluation).
+    if (   !RootNode
+        &&  Tablebases::MaxPieces
+        && !excludedMove
+        &&  pos.rule50_count() == 0
+        &&  popcount<Full>(pos.pieces()) <= Tablebases::MaxPieces)
+    {
+        Tablebases::WDLScore wdl;
+
+        STAT_INC(thisThread, TB_PROBES);
+
+        if (Tablebases::probe_wdl(pos, &wdl))
+        {
+            STAT_INC(thisThread, TB_HITS);
+
+            return  wdl == Tablebases::WDL_WIN  ? VALUE_MATE_IN_MAX_PLY - ss->ply
+                  : wdl == Tablebases::WDL_LOSS ? VALUE_MATED_IN_MAX_PLY + ss->ply : VALUE_DRAW;
+        }
+    }
+
     // Step 5. Evaluate the position statically and update parent's gain statistics
     if (inCheck)
         ss->eval = ss->evalMargin = VALUE_NONE;
-    else if (tte)
+    else if (tte && tte->static_value() != VALUE_NONE)
     {
-        assert(tte->static_value() != VALUE_NONE);
-
         ss->eval = tte->static_value();
         ss->evalMargin = tte->static_value_margin();
         refinedValue = refine_eval(tte, ttValue, ss->eval);
@@ -635,7 +659,12 @@ namespace {
     else
     {
         refinedValue = ss->eval = evaluate(pos, ss->evalMargin);
-        TT.store(posKey, VALUE_NONE, BOUND_NONE, DEPTH_NONE, MOVE_NONE, ss->eval, ss->evalMargin);
+
+        // Entries stored by qsearch after a lazy evaluation have no static value
+        if (tte)
+            refinedValue = refine_eval(tte, ttValue, ss->eval);
+        else
+            TT.store(posKey, VALUE_NONE, BOUND_NONE, DEPTH_NONE, MOVE_NONE, ss->eval, ss->evalMargin);
     }
 
     // Update gain for the parent non-capture move given the static position
@@ -697,6 +726,7 @@ namespace {
         if (refinedValue - PawnValueMg > beta)
             R += ONE_PLY;
 
+        STAT_INC(thisThread, NULL_MOVE_TRIES);
         pos.do_null_move<true>(st);
         (ss+1)->skipNullMove = true;
         nullValue = depth-R < ONE_PLY ? -qsearch<NonPV>(pos, ss+1, -beta, -alpha, DEPTH_ZERO)
@@ -706,6 +736,8 @@ namespace {
 
         if (nullValue >= beta)
         {
+            STAT_INC(thisThread, NULL_MOVE_CUTOFFS);
+
             // Do not return unproven mate scores
             if (nullValue >= VALUE_MATE_IN_MAX_PLY)
                 nullValue = beta;
@@ -750,7 +782,7 @@ namespace {
         &&  excludedMove == MOVE_NONE
         &&  abs(beta) < VALUE_MATE_IN_MAX_PLY)
     {
-        Value rbeta = beta + 200;
+        Value rbeta = std::min(beta + 200, VALUE_INFINITE);
         Depth rdepth = depth - ONE_PLY - 3 * ONE_PLY;
 
         assert(rdepth >= ONE_PLY);
@@ -952,6 +984,12 @@ split_point_start: // At split points actual search starts from here
           value = -search<NonPV>(pos, ss+1, -(alpha+1), -alpha, d);
 
           doFullDepthSearch = (value > alpha && ss->reduction != DEPTH_ZERO);
+
+          STAT_INC(thisThread, LMR_SEARCHES);
+          STAT_HIST(thisThread, LMR_REDUCTION, ss->reduction / ONE_PLY);
+          if (doFullDepthSearch)
+              STAT_INC(thisThread, LMR_RESEARCHES);
+
           ss->reduction = DEPTH_ZERO;
       }
       else
@@ -1023,6 +1061,14 @@ split_point_start: // At split points actual search starts from here
               && value < beta) // We want always alpha < beta
               alpha = value;
 
+          if (value >= beta)
+          {
+              STAT_INC(thisThread, FAIL_HIGHS);
+              STAT_HIST(thisThread, CUTOFF_MOVE_NUMBER, moveCount);
+              if (moveCount == 1)
+                  STAT_INC(thisThread, FAIL_HIGHS_FIRST);
+          }
+
           if (SpNode && !thisThread->cutoff_occurred())
           {
               sp->bestValue = value;
@@ -1118,8 +1164,9 @@ split_point_start: // At split points actual search starts from here
 
     StateInfo st;
     Move ttMove, move, bestMove;
-    Value ttValue, bestValue, value, evalMargin, futilityValue, futilityBase;
+    Value ttValue, bestValue, value, evalMargin, ttEval, ttEvalMargin, futilityValue, futilityBase;
     bool inCheck, enoughMaterial, givesCheck, evasionPrunable;
+    bool lazyEval = false;
     const TTEntry* tte;
     Depth ttDepth;
     Bound bt;
@@ -1128,6 +1175,8 @@ split_point_start: // At split points actual search starts from here
     ss->currentMove = bestMove = MOVE_NONE;
     ss->ply = (ss-1)->ply + 1;
 
+    STAT_INC(pos.this_thread(), QSEARCH_NODES);
+
     // Check for an instant draw or maximum ply reached
     if (pos.is_draw<true>() || ss->ply > MAX_PLY)
         return VALUE_DRAW;
@@ -1144,8 +1193,16 @@ split_point_start: // At split points actual search starts from here
     ttMove = (tte ? tte->move() : MOVE_NONE);
     ttValue = tte ? value_from_tt(tte->value(),ss->ply) : VALUE_ZERO;
 
+    pos.this_thread()->ttProbes++;
+    pos.this_thread()->ttHits += (tte != NULL);
+
+    STAT_INC(pos.this_thread(), TT_PROBES);
+    if (tte)
+        STAT_INC(pos.this_thread(), TT_HITS);
+
     if (!PvNode && tte && can_return_tt(tte, ttDepth, ttValue, beta))
     {
+        STAT_INC(pos.this_thread(), TT_CUTOFFS);
         ss->currentMove = ttMove; // Can be MOVE_NONE
         return ttValue;
     }
@@ -1154,26 +1211,31 @@ split_point_start: // At split points actual search starts from here
     if (inCheck)
     {
         bestValue = futilityBase = -VALUE_INFINITE;
-        ss->eval = evalMargin = VALUE_NONE;
+        ss->eval = evalMargin = ttEval = ttEvalMargin = VALUE_NONE;
         enoughMaterial = false;
     }
     else
     {
-        if (tte)
+        if (tte && tte->static_value() != VALUE_NONE)
         {
-            assert(tte->static_value() != VALUE_NONE);
-
             evalMargin = tte->static_value_margin();
             ss->eval = bestValue = tte->static_value();
         }
-        else
+        else if (PvNode)
             ss->eval = bestValue = evaluate(pos, evalMargin);
+        else
+            ss->eval = bestValue = evaluate(pos, evalMargin, alpha, beta, lazyEval);
+
+        // A lazy evaluation is good enough for stand pat and futility in this
+        // node, but it is not the static value of the position: don't store it.
+        ttEval       = lazyEval ? VALUE_NONE : ss->eval;
+        ttEvalMargin = lazyEval ? VALUE_NONE : evalMargin;
 
         // Stand pat. Return immediately if static value is at least beta
         if (bestValue >= beta)
         {
             if (!tte)
-                TT.store(pos.key(), value_to_tt(bestValue, ss->ply), BOUND_LOWER, DEPTH_NONE, MOVE_NONE, ss->eval, evalMargin);
+                TT.store(pos.key(), value_to_tt(bestValue, ss->ply), BOUND_LOWER, DEPTH_NONE, MOVE_NONE, ttEval, ttEvalMargin);
 
             return bestValue;
         }
@@ -1289,7 +1351,7 @@ split_point_start: // At split points actual search starts from here
     bt   = bestValue <= oldAlpha ? BOUND_UPPER
          : bestValue >= beta ? BOUND_LOWER : BOUND_EXACT;
 
-    TT.store(pos.key(), value_to_tt(bestValue, ss->ply), bt, ttDepth, move, ss->eval, evalMargin);
+    TT.store(pos.key(), value_to_tt(bestValue, ss->ply), bt, ttDepth, move, ttEval, ttEvalMargin);
 
     assert(bestValue > -VALUE_INFINITE && bestValue < VALUE_INFINITE);
 
@@ -1715,6 +1777,8 @@ void Thread::idle_loop() {
 
           sp->mutex.lock();
 
+          int64_t t = Time::now_us();
+
           if (sp->nodeType == Root)
               search<SplitPointRoot>(pos, ss+1, sp->alpha, sp->beta, sp->depth);
           else if (sp->nodeType == PV)
@@ -1724,6 +1788,8 @@ void Thread::idle_loop() {
           else
               assert(false);
 
+          busyTime += Time::now_us() - t;
+
           assert(is_searching);
 
           is_searching = false;
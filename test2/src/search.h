@@ -93,6 +93,17 @@ struct SignalsType {
   bool stopOnPonderhit, firstRootMove, stop, failedLowAtRoot;
 };
 
+
+/// The IterationInfo struct records the best move at the end of each completed
+/// iteration, used by test suite runners to find the time to solution.
+
+struct IterationInfo {
+  int depth;
+  Time::point elapsed;
+  Move move;
+  Value score;
+};
+
 typedef std::auto_ptr<std::stack<StateInfo> > StateStackPtr;
 
 extern volatile SignalsType Signals;
@@ -101,6 +112,8 @@ extern std::vector<RootMove> RootMoves;
 extern Position RootPosition;
 extern Time::point SearchTime;
 extern StateStackPtr SetupStates;
+extern int CompletedDepth;
+extern std::vector<IterationInfo> Iterations;
 
 extern void init();
 extern size_t perft(Position& pos, Depth depth);
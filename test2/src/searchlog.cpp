@@ -0,0 +1,213 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2012 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <deque>
+#include <fstream>
+
+#include "notation.h"
+#include "searchlog.h"
+#include "thread.h"
+
+using namespace std;
+
+namespace {
+
+  enum EntryType { SEARCH_STARTED, ITERATION_DONE, SEARCH_DONE, EXIT };
+
+  struct Entry {
+
+    Entry(EntryType t) : type(t), pos(NULL) {}
+
+    EntryType type;
+    string fileName;
+    Position* pos; // Root position, only in SEARCH_STARTED and owned by the entry
+    Search::LimitsType limits;
+    int depth;
+    Value value;
+    Time::point elapsed;
+    int64_t nodes;
+    vector<Move> pv; // Terminated by MOVE_NONE
+  };
+
+  // Shared with the writer thread
+  Mutex mutex;
+  ConditionVariable sleepCond;
+  deque<Entry> entries;
+  NativeHandle handle;
+  bool running;
+
+  // Used only by the writer thread
+  ofstream file;
+  string fileName;
+  Position root;
+
+  // write() formats an entry into the log file. The positions of the later
+  // entries are the root of the last SEARCH_STARTED one.
+  void write(Entry& e) {
+
+    if (e.type == SEARCH_STARTED)
+    {
+        if (!file.is_open() || e.fileName != fileName)
+        {
+            file.close();
+            file.clear();
+            file.open(e.fileName.c_str(), ios::out | ios::app);
+            fileName = e.fileName;
+        }
+
+        root = *e.pos;
+        delete e.pos;
+
+        Color us = root.side_to_move();
+
+        file << "\nSearching: "  << root.to_fen()
+             << "\ninfinite: "   << e.limits.infinite
+             << " ponder: "      << e.limits.ponder
+             << " time: "        << e.limits.time[us]
+             << " increment: "   << e.limits.inc[us]
+             << " moves to go: " << e.limits.movestogo
+             << "\n";
+    }
+    else if (e.type == ITERATION_DONE)
+        file << pretty_pv(root, e.depth, e.value, e.elapsed, e.nodes, &e.pv[0]) << "\n";
+
+    else
+    {
+        StateInfo st;
+
+        file << "Nodes: "          << e.nodes
+             << "\nNodes/second: " << e.nodes * 1000 / e.elapsed
+             << "\nBest move: "    << move_to_san(root, e.pv[0]);
+
+        root.do_move(e.pv[0], st);
+        file << "\nPonder move: " << move_to_san(root, e.pv[1]) << "\n";
+        root.undo_move(e.pv[0]);
+    }
+
+    file.flush(); // Keep the log complete if the engine crashes
+  }
+
+  // writer() is the loop of the writer thread, it exits on the EXIT entry
+  long writer(void*) {
+
+    while (true)
+    {
+        mutex.lock();
+
+        while (entries.empty())
+            sleepCond.wait(mutex);
+
+        Entry e = entries.front();
+        entries.pop_front();
+        mutex.unlock();
+
+        if (e.type == EXIT)
+            break;
+
+        write(e);
+    }
+
+    file.close();
+    return 0;
+  }
+
+  // push() queues an entry, the writer thread is started on the first one
+  void push(Entry& e) {
+
+    mutex.lock();
+
+    if (!running && !(running = thread_create(handle, writer, NULL)))
+    {
+        mutex.unlock();
+        write(e); // Fall back on writing from the calling thread
+        return;
+    }
+
+    entries.push_back(e);
+    sleepCond.notify_one();
+    mutex.unlock();
+  }
+
+} // namespace
+
+
+/// SearchLog::search_started() opens a new entry in the log. The position is
+/// copied to convert the moves of the following entries to SAN.
+
+void SearchLog::search_started(const string& fileName, const Position& pos,
+                               const Search::LimitsType& limits) {
+  Entry e(SEARCH_STARTED);
+  e.fileName = fileName;
+  e.pos = new Position();
+  *e.pos = pos;
+  e.limits = limits;
+  push(e);
+}
+
+
+/// SearchLog::iteration_done() logs the PV of a completed iteration
+
+void SearchLog::iteration_done(int depth, Value v, Time::point elapsed,
+                               int64_t nodes, const vector<Move>& pv) {
+  Entry e(ITERATION_DONE);
+  e.depth = depth;
+  e.value = v;
+  e.elapsed = elapsed;
+  e.nodes = nodes;
+  e.pv = pv;
+  push(e);
+}
+
+
+/// SearchLog::search_done() logs the search statistics and the best move
+
+void SearchLog::search_done(Time::point elapsed, int64_t nodes, Move best, Move ponder) {
+
+  Entry e(SEARCH_DONE);
+  e.elapsed = elapsed;
+  e.nodes = nodes;
+  e.pv.push_back(best);
+  e.pv.push_back(ponder);
+  push(e);
+}
+
+
+/// SearchLog::exit() writes the pending entries and terminates the writer
+/// thread. It must be called before the search threads are destroyed, because
+/// the logged positions still refer to the main one.
+
+void SearchLog::exit() {
+
+  Entry e(EXIT);
+
+  mutex.lock();
+  bool wasRunning = running;
+
+  if (running)
+  {
+      entries.push_back(e);
+      sleepCond.notify_one();
+      running = false;
+  }
+
+  mutex.unlock();
+
+  if (wasRunning)
+      thread_join(handle);
+}
@@ -0,0 +1,42 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2012 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(SEARCHLOG_H_INCLUDED)
+#define SEARCHLOG_H_INCLUDED
+
+#include <string>
+#include <vector>
+
+#include "misc.h"
+#include "search.h"
+
+/// The SearchLog namespace writes the search log enabled by the "Use Search
+/// Log" option. The search only queues the raw data of each entry: a background
+/// thread keeps the file open and does the formatting, SAN conversion included.
+
+namespace SearchLog {
+
+void search_started(const std::string& fileName, const Position& pos, const Search::LimitsType& limits);
+void iteration_done(int depth, Value v, Time::point elapsed, int64_t nodes, const std::vector<Move>& pv);
+void search_done(Time::point elapsed, int64_t nodes, Move best, Move ponder);
+void exit();
+
+}
+
+#endif // !defined(SEARCHLOG_H_INCLUDED)
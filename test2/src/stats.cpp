@@ -0,0 +1,146 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2012 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "misc.h"
+#include "stats.h"
+#include "thread.h"
+
+using namespace std;
+
+#if defined(USE_STATS)
+namespace {
+
+  const char* CounterNames[] = {
+    "Search nodes", "Qsearch nodes",
+    "TT probes", "TT hits", "TT cutoffs",
+    "Null move tries", "Null move cutoffs",
+    "LMR searches", "LMR re-searches",
+    "Fail highs", "Fail highs on 1st move",
+    "Split tries", "Splits",
+    "Eval cache probes", "Eval cache hits",
+    "Lazy evals", "Lazy exits on material", "Lazy exits on pawns",
+    "Tablebase probes", "Tablebase hits"
+  };
+
+  const char* HistogramNames[] = {
+    "Cutoff move number", "LMR reduction (plies)", "Slaves per split"
+  };
+
+  // percent() returns a/b as a percentage, formatted with one decimal digit
+  string percent(uint64_t a, uint64_t b) {
+
+    stringstream s;
+    s << fixed << setprecision(1) << (b ? 100.0 * a / b : 0.0) << "%";
+    return s.str();
+  }
+
+}
+#endif
+
+namespace Stats {
+
+/// Stats::clear() resets the statistics of all the threads. It should be
+/// called only when no search is running.
+
+void clear() {
+
+#if defined(USE_STATS)
+  for (size_t i = 0; i < Threads.size(); i++)
+      Threads[i].stats.clear();
+#endif
+}
+
+
+/// Stats::print() sums the statistics of all the threads and prints them
+/// together with the most interesting ratios. It is called by the "stats"
+/// UCI command.
+
+void print() {
+
+#if defined(USE_STATS)
+  Table t;
+
+  for (size_t i = 0; i < Threads.size(); i++)
+      for (int c = 0; c < COUNTER_NB; c++)
+          t.counters[c] += Threads[i].stats.counters[c];
+
+  for (size_t i = 0; i < Threads.size(); i++)
+      for (int h = 0; h < HISTOGRAM_NB; h++)
+          for (int b = 0; b < HistogramBins; b++)
+              t.histograms[h][b] += Threads[i].stats.histograms[h][b];
+
+  const uint64_t* c = t.counters;
+  stringstream s;
+
+  s << "\nSearch statistics (" << Threads.size() << " threads)\n";
+
+  for (int i = 0; i < COUNTER_NB; i++)
+      s << setw(24) << left << CounterNames[i] << ": " << c[i] << "\n";
+
+  s << "\n" << setw(24) << left << "Qsearch share"       << ": " << percent(c[QSEARCH_NODES], c[SEARCH_NODES] + c[QSEARCH_NODES])
+    << "\n" << setw(24) << left << "TT hit rate"         << ": " << percent(c[TT_HITS], c[TT_PROBES])
+    << "\n" << setw(24) << left << "TT cutoff rate"      << ": " << percent(c[TT_CUTOFFS], c[TT_PROBES])
+    << "\n" << setw(24) << left << "Null move success"   << ": " << percent(c[NULL_MOVE_CUTOFFS], c[NULL_MOVE_TRIES])
+    << "\n" << setw(24) << left << "LMR re-search rate"  << ": " << percent(c[LMR_RESEARCHES], c[LMR_SEARCHES])
+    << "\n" << setw(24) << left << "First move fail high" << ": " << percent(c[FAIL_HIGHS_FIRST], c[FAIL_HIGHS])
+    << "\n" << setw(24) << left << "Split success"       << ": " << percent(c[SPLITS], c[SPLIT_TRIES])
+    << "\n" << setw(24) << left << "Eval cache hit rate" << ": " << percent(c[EVAL_CACHE_HITS], c[EVAL_CACHE_PROBES])
+    << "\n" << setw(24) << left << "Lazy exit rate"      << ": " << percent(c[LAZY_EXITS_MATERIAL] + c[LAZY_EXITS_PAWNS], c[LAZY_EVALS])
+    << "\n";
+
+  for (int h = 0; h < HISTOGRAM_NB; h++)
+  {
+      s << "\n" << HistogramNames[h] << ":\n";
+
+      for (int b = 0; b < HistogramBins; b++)
+          if (t.histograms[h][b])
+              s << setw(4) << right << b << (b == HistogramBins - 1 ? "+" : " ")
+                << setw(14) << t.histograms[h][b] << "\n";
+  }
+
+  sync_cout << s.str() << sync_endl;
+#else
+  sync_cout << "info string Search statistics are not available, "
+            << "compile with -DUSE_STATS to enable them" << sync_endl;
+#endif
+}
+
+
+/// Stats::total() returns a counter summed over all the threads, always 0 when
+/// the statistics are not compiled in.
+
+uint64_t total(Counter c) {
+
+  uint64_t sum = 0;
+
+#if defined(USE_STATS)
+  for (size_t i = 0; i < Threads.size(); i++)
+      sum += Threads[i].stats.counters[c];
+#else
+  (void)c;
+#endif
+
+  return sum;
+}
+
+} // namespace Stats
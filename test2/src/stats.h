@@ -0,0 +1,80 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2012 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if !defined(STATS_H_INCLUDED)
+#define STATS_H_INCLUDED
+
+#include <algorithm>
+#include <cstring>
+
+#include "types.h"
+
+/// Search statistics are collected per thread and only when the engine is
+/// compiled with -DUSE_STATS. Otherwise the STAT_* macros expand to nothing
+/// and Thread does not even carry the counters, so that a normal build pays
+/// nothing for the instrumentation. Being per thread, counters are updated
+/// without any locking and are summed only when printed.
+
+namespace Stats {
+
+enum Counter {
+  SEARCH_NODES, QSEARCH_NODES,
+  TT_PROBES, TT_HITS, TT_CUTOFFS,
+  NULL_MOVE_TRIES, NULL_MOVE_CUTOFFS,
+  LMR_SEARCHES, LMR_RESEARCHES,
+  FAIL_HIGHS, FAIL_HIGHS_FIRST,
+  SPLIT_TRIES, SPLITS,
+  EVAL_CACHE_PROBES, EVAL_CACHE_HITS,
+  LAZY_EVALS, LAZY_EXITS_MATERIAL, LAZY_EXITS_PAWNS,
+  TB_PROBES, TB_HITS,
+  COUNTER_NB
+};
+
+enum Histogram {
+  CUTOFF_MOVE_NUMBER, LMR_REDUCTION, SPLIT_SLAVES,
+  HISTOGRAM_NB
+};
+
+const int HistogramBins = 16; // Last bin collects all the overflowing samples
+
+struct Table {
+
+  Table() { clear(); }
+  void clear() { memset(this, 0, sizeof(Table)); }
+  void add(Histogram h, int v) { histograms[h][std::min(std::max(v, 0), HistogramBins - 1)]++; }
+
+  uint64_t counters[COUNTER_NB];
+  uint64_t histograms[HISTOGRAM_NB][HistogramBins];
+};
+
+extern void clear();
+extern void print();
+extern uint64_t total(Counter c);
+
+}
+
+#if defined(USE_STATS)
+#  define STAT_INC(th, c)     ((th)->stats.counters[Stats::c]++)
+#  define STAT_HIST(th, h, v) ((th)->stats.add(Stats::h, int(v)))
+#else
+#  define STAT_INC(th, c)     ((void)0)
+#  define STAT_HIST(th, h, v) ((void)0)
+#endif
+
+#endif // !defined(STATS_H_INCLUDED)
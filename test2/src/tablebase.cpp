@@ -0,0 +1,1017 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2012 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "bitcount.h"
+#include "misc.h"
+#include "position.h"
+#include "tablebase.h"
+#include "ucioption.h"
+
+using std::string;
+
+int Tablebases::MaxPieces = 0;
+
+namespace {
+
+  const int MaxTBPieces = 5;
+  const int HeaderSize = 16; // Magic, version, number of pieces, unused
+  const uint32_t TBMagic = 0x42544653; // "SFTB"
+  const uint32_t TBVersion = 1;
+
+  // Results are stored in the files with two bits per position, from the point
+  // of view of the side to move. While generating, a byte per position is used
+  // with the UNKNOWN bit set until the position is resolved, and HAS_DRAW set
+  // when a capture or a promotion reaches a draw, so that it can not be a loss.
+  enum Result {
+    DRAW = 0, WIN = 1, LOSS = 2, INVALID = 3, UNKNOWN = 4, HAS_DRAW = 8
+  };
+
+  // A table is named after its material, as "KRPvKR", with the stronger side
+  // first. In the table the stronger side is white and the pieces are in the
+  // order: white king, black king, the other white pieces and the black ones.
+  struct Table {
+    string name;
+    int pieceCnt;
+    Piece pieces[MaxTBPieces];
+    bool hasPawns;
+    uint64_t size;       // Number of positions for each side to move
+    const uint8_t* data; // Mapped file, after the header
+    const void* mapping;
+    uint64_t mappedSize;
+  };
+
+  struct TableRef {
+    Table* table;
+    bool flip; // Colors of the position are swapped with respect to the table
+  };
+
+  // A position as a list of pieces, used for probing and for generation
+  struct Board {
+    int n;
+    Square sq[MaxTBPieces];
+    Piece pc[MaxTBPieces];
+    Color stm;
+  };
+
+  std::vector<Table*> Tables;
+  std::map<Key, TableRef> TableMap;
+  volatile bool ProbeFailed; // Set by the generator threads, see probe_child()
+
+  // Squares of the strong king in the canonical orientation: files A-D for the
+  // tables with pawns, the A1-D1-D4 triangle otherwise.
+  int KingIndex[2][64]; // [hasPawns][square], -1 if not canonical
+  Square KingSquare[2][32];
+
+  void init_indices();
+  std::vector<string> table_names(int maxPieces);
+  Table* new_table(const string& name);
+  bool map_table(Table* t, const string& path);
+  void unmap_table(Table* t);
+  void add_table(Table* t);
+  bool probe_board(const Board& b, Result* r);
+  bool generate_table(Table* t, const string& path, int threads);
+  bool generation_order(const string& s1, const string& s2);
+}
+
+
+/// Tablebases::init() maps all the tables found in the given directory. An
+/// empty path releases the tables.
+
+void Tablebases::init(const string& path) {
+
+  for (size_t i = 0; i < Tables.size(); i++)
+  {
+      unmap_table(Tables[i]);
+      delete Tables[i];
+  }
+
+  Tables.clear();
+  TableMap.clear();
+  MaxPieces = 0;
+
+  if (path.empty() || path == "<empty>")
+      return;
+
+  init_indices();
+
+  std::vector<string> names = table_names(MaxTBPieces);
+
+  for (size_t i = 0; i < names.size(); i++)
+  {
+      Table* t = new_table(names[i]);
+
+      if (map_table(t, path))
+          add_table(t);
+      else
+          delete t;
+  }
+
+  sync_cout << "info string Found " << Tables.size() << " tablebases in " << path << sync_endl;
+}
+
+
+/// Tablebases::probe_wdl() looks up the position in the mapped tables. It
+/// returns false if the position is not covered: too many pieces, castling
+/// rights or an en-passant square (not considered by the tables).
+
+bool Tablebases::probe_wdl(const Position& pos, WDLScore* result) {
+
+  Bitboard occ = pos.pieces();
+
+  if (   popcount<Full>(occ) > MaxPieces
+      || pos.can_castle(ALL_CASTLES)
+      || pos.ep_square() != SQ_NONE)
+      return false;
+
+  Board b;
+  b.n = 0;
+  b.stm = pos.side_to_move();
+
+  while (occ)
+  {
+      Square s = pop_lsb(&occ);
+      b.sq[b.n] = s;
+      b.pc[b.n++] = pos.piece_on(s);
+  }
+
+  Result r;
+
+  if (!probe_board(b, &r) || r == INVALID)
+      return false;
+
+  *result = r == WIN ? WDL_WIN : r == LOSS ? WDL_LOSS : WDL_DRAW;
+  return true;
+}
+
+
+/// Tablebases::generate() is called by the "tbgen [pieces | table] [threads]"
+/// command. It generates all the missing tables up to the given number of pieces
+/// (default 4, at most 5) in the directory of the "Tablebase Path" option (the
+/// current one if empty), using the given number of threads (default "Threads").
+/// Given a table name, as "KQvKR", it generates only that table and the missing
+/// ones it depends on. The tables already there are kept and used for the
+/// captures and promotions. Errors stop the command with a message.
+
+void Tablebases::generate(std::istream& is) {
+
+  string path = Options["Tablebase Path"], token, only;
+  int pieces = 4, threads = Options["Threads"];
+
+  if (is >> token)
+  {
+      if (token.find('v') != string::npos)
+      {
+          only = token;
+          pieces = int(token.size()) - 1;
+      }
+      else
+          pieces = atoi(token.c_str());
+  }
+
+  is >> threads;
+  pieces = std::min(std::max(pieces, 3), MaxTBPieces);
+  threads = std::max(threads, 1);
+
+  if (path.empty() || path == "<empty>")
+      path = ".";
+
+  init(path);
+
+  std::vector<string> names = table_names(pieces);
+  Time::point elapsed = Time::now();
+
+  if (!only.empty())
+  {
+      if (std::find(names.begin(), names.end(), only) == names.end())
+      {
+          std::cerr << "Unknown tablebase " << only << std::endl;
+          return;
+      }
+
+      // Captures and promotions reach the tables with fewer pieces, and with as
+      // many pieces and fewer pawns: the ones before it in generation order.
+      std::vector<string> needed;
+
+      for (size_t i = 0; i < names.size(); i++)
+          if (generation_order(names[i], only))
+              needed.push_back(names[i]);
+
+      needed.push_back(only);
+      names = needed;
+  }
+
+  for (size_t i = 0; i < names.size(); i++)
+  {
+      bool found = false;
+
+      for (size_t j = 0; j < Tables.size() && !found; j++)
+          found = Tables[j]->name == names[i];
+
+      if (found)
+          continue;
+
+      Table* t = new_table(names[i]);
+
+      if (!generate_table(t, path, threads)) // Reports the error
+      {
+          delete t;
+          return;
+      }
+
+      if (!map_table(t, path))
+      {
+          std::cerr << "Unable to map the generated table " << t->name << std::endl;
+          delete t;
+          return;
+      }
+
+      add_table(t);
+  }
+
+  sync_cout << "info string " << Tables.size() << " tablebases up to " << pieces
+            << " pieces, generated in " << (Time::now() - elapsed) / 1000 << " s" << sync_endl;
+}
+
+
+namespace {
+
+  // Helpers to go from a position to the index in a table and back
+
+  void init_indices() {
+
+    int k[2] = { 0, 0 };
+
+    for (Square s = SQ_A1; s <= SQ_H8; s++)
+    {
+        KingIndex[0][s] = KingIndex[1][s] = -1;
+
+        if (file_of(s) <= FILE_D && rank_of(s) <= RANK_4 && rank_of(s) <= int(file_of(s)))
+            KingSquare[0][KingIndex[0][s] = k[0]++] = s;
+
+        if (file_of(s) <= FILE_D)
+            KingSquare[1][KingIndex[1][s] = k[1]++] = s;
+    }
+  }
+
+
+  // normalize() applies to all the squares the symmetry that brings the strong
+  // king, the first piece, to the canonical squares.
+
+  void normalize(Square sq[], int n, bool hasPawns) {
+
+    if (file_of(sq[0]) > FILE_D)
+        for (int i = 0; i < n; i++)
+            sq[i] = mirror(sq[i]);
+
+    if (hasPawns)
+        return;
+
+    if (rank_of(sq[0]) > RANK_4)
+        for (int i = 0; i < n; i++)
+            sq[i] = ~sq[i];
+
+    if (int(rank_of(sq[0])) > int(file_of(sq[0])))
+        for (int i = 0; i < n; i++)
+            sq[i] = Square(((sq[i] & 7) << 3) | (sq[i] >> 3));
+  }
+
+
+  // encode() returns the index in table 't' of position 'b' and its side to
+  // move from the point of view of the table.
+
+  uint64_t encode(const Table& t, bool flip, const Board& b, Color* stm) {
+
+    Square sq[MaxTBPieces];
+    bool used[MaxTBPieces] = { false };
+
+    assert(b.n == t.pieceCnt);
+
+    for (int i = 0; i < t.pieceCnt; i++)
+        for (int j = 0; j < b.n; j++)
+            if (!used[j] && Piece(flip ? b.pc[j] ^ 8 : b.pc[j]) == t.pieces[i])
+            {
+                used[j] = true;
+                sq[i] = flip ? ~b.sq[j] : b.sq[j];
+                break;
+            }
+
+    *stm = flip ? ~b.stm : b.stm;
+    normalize(sq, t.pieceCnt, t.hasPawns);
+
+    uint64_t idx = KingIndex[t.hasPawns][sq[0]];
+
+    for (int i = 1; i < t.pieceCnt; i++)
+        idx = idx * 64 + sq[i];
+
+    return idx;
+  }
+
+
+  // decode() is the inverse of encode(), for the canonical positions
+
+  void decode(const Table& t, uint64_t idx, Board& b) {
+
+    b.n = t.pieceCnt;
+
+    for (int i = t.pieceCnt - 1; i > 0; i--, idx /= 64)
+    {
+        b.sq[i] = Square(idx % 64);
+        b.pc[i] = t.pieces[i];
+    }
+
+    b.sq[0] = KingSquare[t.hasPawns][idx];
+    b.pc[0] = t.pieces[0];
+  }
+
+
+  Key material_key(const Piece pieces[], int n, bool flip) {
+
+    int cnt[2][8] = { { 0 } };
+    Key k = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        Color c = Color(color_of(pieces[i]) ^ flip);
+        PieceType pt = type_of(pieces[i]);
+
+        if (pt != KING)
+            k ^= Zobrist::psq[c][pt][cnt[c][pt]++];
+    }
+
+    return k;
+  }
+
+
+  // Table names and mapping
+
+  const string PieceChars = " PNBRQK";
+
+  // stronger() defines the order of the sides in the table names: more pieces
+  // first, then the most valuable pieces.
+  bool stronger(const string& s1, const string& s2) {
+
+    if (s1.size() != s2.size())
+        return s1.size() > s2.size();
+
+    for (size_t i = 0; i < s1.size(); i++)
+        if (s1[i] != s2[i])
+            return PieceChars.find(s1[i]) > PieceChars.find(s2[i]);
+
+    return false;
+  }
+
+  void add_sides(std::vector<string>& sides, const string& side, PieceType maxPt, int left) {
+
+    sides.push_back(side);
+
+    if (left)
+        for (PieceType pt = maxPt; pt >= PAWN; pt--)
+            add_sides(sides, side + PieceChars[pt], pt, left - 1);
+  }
+
+  int count_pawns(const string& s) { return int(std::count(s.begin(), s.end(), 'P')); }
+
+  bool generation_order(const string& s1, const string& s2) {
+    return   s1.size() != s2.size() ? s1.size() < s2.size()
+                                    : count_pawns(s1) < count_pawns(s2);
+  }
+
+  // table_names() returns the names of all the tables up to the given number of
+  // pieces, in an order where the tables reached by a capture or a promotion
+  // come first.
+  std::vector<string> table_names(int maxPieces) {
+
+    std::vector<string> sides, names;
+
+    add_sides(sides, "K", QUEEN, maxPieces - 2);
+
+    for (size_t i = 0; i < sides.size(); i++)
+        for (size_t j = 0; j < sides.size(); j++)
+            if (   sides[i].size() + sides[j].size() <= size_t(maxPieces)
+                && sides[i].size() + sides[j].size() > 2
+                && !stronger(sides[j], sides[i]))
+                names.push_back(sides[i] + "v" + sides[j]);
+
+    std::stable_sort(names.begin(), names.end(), generation_order);
+    return names;
+  }
+
+  Table* new_table(const string& name) {
+
+    Table* t = new Table();
+    size_t v = name.find('v');
+    string white = name.substr(1, v - 1), black = name.substr(v + 2);
+
+    t->name = name;
+    t->pieceCnt = 0;
+    t->pieces[t->pieceCnt++] = W_KING;
+    t->pieces[t->pieceCnt++] = B_KING;
+
+    for (size_t i = 0; i < white.size(); i++)
+        t->pieces[t->pieceCnt++] = make_piece(WHITE, PieceType(PieceChars.find(white[i])));
+
+    for (size_t i = 0; i < black.size(); i++)
+        t->pieces[t->pieceCnt++] = make_piece(BLACK, PieceType(PieceChars.find(black[i])));
+
+    t->hasPawns = name.find('P') != string::npos;
+    t->size = t->hasPawns ? 32 : 10;
+
+    for (int i = 1; i < t->pieceCnt; i++)
+        t->size *= 64;
+
+    return t;
+  }
+
+  void add_table(Table* t) {
+
+    TableRef r = { t, false };
+    TableMap[material_key(t->pieces, t->pieceCnt, false)] = r;
+
+    r.flip = true;
+    TableMap.insert(std::make_pair(material_key(t->pieces, t->pieceCnt, true), r));
+
+    Tables.push_back(t);
+    Tablebases::MaxPieces = std::max(Tablebases::MaxPieces, t->pieceCnt);
+  }
+
+  string file_name(const Table* t, const string& path) {
+    return path + "/" + t->name + ".sftb";
+  }
+
+  // map_table() maps the file of the table read-only in memory and checks its
+  // header and size.
+  bool map_table(Table* t, const string& path) {
+
+    string fname = file_name(t, path);
+    uint64_t size;
+    const void* base = map_file(fname, &size);
+
+    if (!base)
+        return false;
+
+    t->mapping = base;
+    t->mappedSize = size;
+    t->data = (const uint8_t*)base + HeaderSize;
+
+    const uint32_t* header = (const uint32_t*)base;
+
+    if (   size != HeaderSize + 2 * ((t->size + 3) / 4)
+        || header[0] != TBMagic
+        || header[1] != TBVersion
+        || header[2] != uint32_t(t->pieceCnt))
+    {
+        std::cerr << "Corrupted tablebase file " << fname << std::endl;
+        unmap_table(t);
+        return false;
+    }
+
+    return true;
+  }
+
+  void unmap_table(Table* t) {
+
+    if (!t->mapping)
+        return;
+
+    unmap_file(t->mapping, t->mappedSize);
+
+    t->mapping = NULL;
+  }
+
+
+  // probe_board() looks up a position in the mapped tables. Bare kings are a
+  // draw without table.
+  bool probe_board(const Board& b, Result* r) {
+
+    if (b.n == 2)
+    {
+        *r = DRAW;
+        return true;
+    }
+
+    std::map<Key, TableRef>::const_iterator it = TableMap.find(material_key(b.pc, b.n, false));
+
+    if (it == TableMap.end())
+        return false;
+
+    const Table& t = *it->second.table;
+    Color stm;
+    uint64_t idx = encode(t, it->second.flip, b, &stm);
+    const uint8_t* data = t.data + (stm == WHITE ? 0 : (t.size + 3) / 4);
+
+    *r = Result((data[idx / 4] >> (2 * (idx & 3))) & 3);
+    return true;
+  }
+
+
+  // Generation. The tables are computed with repeated passes, alternating the
+  // side to move, over the positions that are not yet resolved, as for KPK.
+  // A position is a win if a move reaches a position lost for the opponent,
+  // and a loss if all the moves reach positions won by the opponent. Captures
+  // and promotions leave the table: they are looked up in the tables with less
+  // material, generated before, and only once. Quiet moves are looked up in the
+  // table being generated, and to avoid scanning again all the positions at
+  // each pass, when a position is resolved its predecessors, found by undoing
+  // the quiet moves, are marked to be scanned at the next pass. The positions
+  // still unresolved when nothing changes anymore are draws.
+
+  enum MoveKind { QUIET, DOUBLE_PUSH, LEAVES_TABLE };
+
+  const int MaxTBMoves = 128;
+
+  Bitboard occupied(const Board& b) {
+
+    Bitboard occ = 0;
+
+    for (int i = 0; i < b.n; i++)
+        occ |= b.sq[i];
+
+    return occ;
+  }
+
+  bool attacked(const Board& b, Square s, Color by, Bitboard occ) {
+
+    for (int i = 0; i < b.n; i++)
+        if (   color_of(b.pc[i]) == by
+            && (Position::attacks_from(b.pc[i], b.sq[i], occ) & s))
+            return true;
+
+    return false;
+  }
+
+  Square king_square(const Board& b, Color c) {
+
+    for (int i = 0; i < b.n; i++)
+        if (b.pc[i] == make_piece(c, KING))
+            return b.sq[i];
+
+    return SQ_NONE;
+  }
+
+  // is_valid() returns false for the indices that are not a legal position
+  bool is_valid(const Board& b) {
+
+    Bitboard occ = occupied(b);
+
+    if (popcount<Max15>(occ) != b.n)
+        return false;
+
+    for (int i = 0; i < b.n; i++)
+        if (type_of(b.pc[i]) == PAWN && ((Rank1BB | Rank8BB) & b.sq[i]))
+            return false;
+
+    return !attacked(b, king_square(b, ~b.stm), b.stm, occ);
+  }
+
+  // make_move() returns in 'child' the position after moving the piece in the
+  // slot 'i' to 'to', promoting to 'promotion' if not NO_PIECE_TYPE.
+  void make_move(const Board& b, Board& child, int i, Square to, PieceType promotion) {
+
+    child = b;
+    child.stm = ~b.stm;
+    child.sq[i] = to;
+
+    if (promotion != NO_PIECE_TYPE)
+        child.pc[i] = make_piece(b.stm, promotion);
+
+    for (int j = 0; j < child.n; j++)
+        if (j != i && child.sq[j] == to)
+        {
+            child.n--;
+            child.sq[j] = child.sq[child.n];
+            child.pc[j] = child.pc[child.n];
+            break;
+        }
+  }
+
+  // generate_moves() returns the positions reached with the legal moves
+  int generate_moves(const Board& b, Board children[], MoveKind kinds[]) {
+
+    const PieceType Promotions[] = { QUEEN, ROOK, BISHOP, KNIGHT };
+
+    Color us = b.stm;
+    Bitboard occ = occupied(b), own = 0;
+    int cnt = 0;
+
+    for (int i = 0; i < b.n; i++)
+        if (color_of(b.pc[i]) == us)
+            own |= b.sq[i];
+
+    for (int i = 0; i < b.n; i++)
+    {
+        if (color_of(b.pc[i]) != us)
+            continue;
+
+        Square from = b.sq[i];
+        Bitboard targets = Position::attacks_from(b.pc[i], from, occ) & ~own;
+        bool isPawn = type_of(b.pc[i]) == PAWN;
+
+        if (isPawn)
+        {
+            Square push = from + pawn_push(us);
+            targets &= occ; // Only captures
+
+            if (!(occ & push))
+            {
+                targets |= push;
+
+                if (   relative_rank(us, from) == RANK_2
+                    && !(occ & (push + pawn_push(us))))
+                {
+                    make_move(b, children[cnt], i, push + pawn_push(us), NO_PIECE_TYPE);
+                    kinds[cnt++] = DOUBLE_PUSH;
+                }
+            }
+        }
+
+        while (targets)
+        {
+            Square to = pop_lsb(&targets);
+            bool promotion = isPawn && relative_rank(us, to) == RANK_8;
+
+            for (int k = 0; k < (promotion ? 4 : 1); k++)
+            {
+                make_move(b, children[cnt], i, to, promotion ? Promotions[k] : NO_PIECE_TYPE);
+                kinds[cnt++] = (occ & to) || promotion ? LEAVES_TABLE : QUIET;
+            }
+        }
+    }
+
+    // Remove the moves that leave our king in check
+    for (int k = 0; k < cnt; )
+    {
+        Bitboard childOcc = occupied(children[k]);
+
+        if (attacked(children[k], king_square(children[k], us), ~us, childOcc))
+        {
+            children[k] = children[--cnt];
+            kinds[k] = kinds[cnt];
+        }
+        else
+            k++;
+    }
+
+    return cnt;
+  }
+
+  // probe_child() returns the result of a position reached by a capture or a
+  // promotion. A missing or inconsistent table sets ProbeFailed, and the
+  // generation stops after the pass.
+  Result probe_child(const Board& b) {
+
+    Result r;
+
+    if (!probe_board(b, &r) || r == INVALID)
+    {
+        ProbeFailed = true;
+        return DRAW;
+    }
+
+    return r;
+  }
+
+  // ep_result() returns, after a double push, the best result of the side to
+  // move among its en-passant captures, or INVALID if there are none.
+  Result ep_result(const Board& b, Square to) {
+
+    Color them = b.stm;
+    Square epSquare = to - pawn_push(~them);
+    Result best = INVALID;
+    Board child;
+
+    for (int i = 0; i < b.n; i++)
+        if (   b.pc[i] == make_piece(them, PAWN)
+            && (StepAttacksBB[make_piece(~them, PAWN)][epSquare] & b.sq[i]))
+        {
+            make_move(b, child, i, epSquare, NO_PIECE_TYPE);
+
+            for (int j = 0; j < child.n; j++)
+                if (child.sq[j] == to)
+                {
+                    child.n--;
+                    child.sq[j] = child.sq[child.n];
+                    child.pc[j] = child.pc[child.n];
+                    break;
+                }
+
+            if (attacked(child, king_square(child, them), ~them, occupied(child)))
+                continue;
+
+            Result r = probe_child(child); // For the opponent of 'them'
+            Result ours = r == WIN ? LOSS : r == LOSS ? WIN : DRAW;
+
+            if (best == INVALID || ours == WIN || (ours == DRAW && best == LOSS))
+                best = ours;
+        }
+
+    return best;
+  }
+
+  // classify_leaf() gives the first classification of a position: invalid,
+  // mate, stalemate, or resolved by the moves that leave the table.
+  uint8_t classify_leaf(Board& b) {
+
+    Board children[MaxTBMoves];
+    MoveKind kinds[MaxTBMoves];
+
+    if (!is_valid(b))
+        return INVALID;
+
+    int cnt = generate_moves(b, children, kinds);
+
+    if (!cnt)
+        return attacked(b, king_square(b, b.stm), ~b.stm, occupied(b)) ? LOSS : DRAW;
+
+    uint8_t state = UNKNOWN;
+    bool quiet = false;
+
+    for (int k = 0; k < cnt; k++)
+        if (kinds[k] == LEAVES_TABLE)
+        {
+            Result r = probe_child(children[k]);
+
+            if (r == LOSS)
+                return WIN;
+
+            if (r == DRAW)
+                state |= HAS_DRAW;
+        }
+        else
+            quiet = true;
+
+    return quiet ? state : uint8_t((state & HAS_DRAW) ? DRAW : LOSS);
+  }
+
+  // classify() scans the quiet moves of an unresolved position with the current
+  // results of the opponent positions.
+  uint8_t classify(const Table& t, Board& b, uint8_t state, const uint8_t* theirs) {
+
+    Board children[MaxTBMoves];
+    MoveKind kinds[MaxTBMoves];
+    bool allLost = !(state & HAS_DRAW);
+    int cnt = generate_moves(b, children, kinds);
+    Color stm;
+
+    for (int k = 0; k < cnt; k++)
+    {
+        if (kinds[k] == LEAVES_TABLE)
+            continue;
+
+        uint8_t v = theirs[encode(t, false, children[k], &stm)];
+        bool theyWin  = v == WIN;
+        bool theyLose = v == LOSS;
+
+        if (kinds[k] == DOUBLE_PUSH)
+        {
+            Square to = children[k].sq[0];
+
+            for (int i = 0; i < b.n; i++)
+                if (children[k].sq[i] != b.sq[i])
+                    to = children[k].sq[i];
+
+            Result ep = ep_result(children[k], to);
+
+            theyWin  = theyWin  || ep == WIN;
+            theyLose = theyLose && (ep == INVALID || ep == LOSS);
+        }
+
+        if (theyLose)
+            return WIN;
+
+        if (!theyWin)
+            allLost = false;
+    }
+
+    return allLost ? uint8_t(LOSS) : state;
+  }
+
+  // mark_predecessors() marks as to be scanned the positions from which a quiet
+  // move of the opponent reaches position 'b'.
+  void mark_predecessors(const Table& t, const Board& b, uint8_t* dirty) {
+
+    Color them = ~b.stm, stm;
+    Bitboard occ = occupied(b);
+    Board p = b;
+
+    p.stm = them;
+
+    for (int i = 0; i < b.n; i++)
+    {
+        if (color_of(b.pc[i]) != them)
+            continue;
+
+        Bitboard from;
+
+        if (type_of(b.pc[i]) == PAWN)
+        {
+            Square back = b.sq[i] - pawn_push(them);
+            from = 0;
+
+            if (!(occ & back) && relative_rank(them, back) >= RANK_2)
+            {
+                from |= back;
+
+                if (relative_rank(them, b.sq[i]) == RANK_4 && !(occ & (back - pawn_push(them))))
+                    from |= back - pawn_push(them);
+            }
+        }
+        else
+            from = Position::attacks_from(b.pc[i], b.sq[i], occ) & ~occ;
+
+        while (from)
+        {
+            p.sq[i] = pop_lsb(&from);
+            dirty[encode(t, false, p, &stm)] = 1;
+        }
+
+        p.sq[i] = b.sq[i];
+    }
+  }
+
+  // A chunk of positions of one side to move, scanned by a thread
+  struct GenJob {
+    const Table* table;
+    std::vector<uint8_t>* db;
+    std::vector<uint8_t>* dirty;
+    Color stm;
+    bool leaves;
+    uint64_t begin, end, changed;
+    NativeHandle handle;
+  };
+
+  long gen_worker(GenJob* job) {
+
+
+    const Table& t = *job->table;
+    uint8_t* db = &job->db[job->stm][0];
+    uint8_t* dirty = &job->dirty[job->stm][0];
+    const uint8_t* theirs = &job->db[~job->stm][0];
+    uint8_t* theirsDirty = &job->dirty[~job->stm][0];
+    Board b;
+
+    for (uint64_t idx = job->begin; idx < job->end; idx++)
+    {
+        if (job->leaves)
+        {
+            decode(t, idx, b);
+            b.stm = job->stm;
+            db[idx] = classify_leaf(b);
+            continue;
+        }
+
+        if (!dirty[idx] || !(db[idx] & UNKNOWN))
+            continue;
+
+        dirty[idx] = 0;
+        decode(t, idx, b);
+        b.stm = job->stm;
+
+        uint8_t r = classify(t, b, db[idx], theirs);
+
+        if (r != db[idx])
+        {
+            db[idx] = r;
+            mark_predecessors(t, b, theirsDirty);
+            job->changed++;
+        }
+    }
+
+    return 0;
+  }
+
+  // run_pass() scans all the positions of one side to move, split among the
+  // threads, and returns the number of positions resolved.
+  uint64_t run_pass(const Table* t, std::vector<uint8_t> db[], std::vector<uint8_t> dirty[],
+                    Color stm, bool leaves, int threads) {
+
+    std::vector<GenJob> jobs(threads);
+    uint64_t chunk = (t->size + threads - 1) / threads, changed = 0;
+
+    for (int i = 0; i < threads; i++)
+    {
+        GenJob job = { t, db, dirty, stm, leaves, std::min(t->size, i * chunk),
+                       std::min(t->size, (i + 1) * chunk), 0, NativeHandle() };
+        jobs[i] = job;
+    }
+
+    // A job whose thread can not be created is run by the calling thread
+    std::vector<bool> started(threads, false);
+
+    for (int i = 1; i < threads; i++)
+        started[i] = thread_create(jobs[i].handle, gen_worker, &jobs[i]);
+
+    gen_worker(&jobs[0]);
+
+    for (int i = 1; i < threads; i++)
+        if (started[i])
+            thread_join(jobs[i].handle);
+        else
+            gen_worker(&jobs[i]);
+
+    for (int i = 0; i < threads; i++)
+        changed += jobs[i].changed;
+
+    return changed;
+  }
+
+  // generate_table() computes the table and writes its file. It returns false,
+  // after reporting the error, if that is not possible.
+  bool generate_table(Table* t, const string& path, int threads) {
+
+    std::vector<uint8_t> db[2], dirty[2]; // [color]
+    Time::point elapsed = Time::now();
+    uint64_t wins = 0, losses = 0, draws = 0;
+    int idlePasses = 0;
+
+    // A result and a dirty byte per position and side to move, plus the two
+    // bits per position of a side when writing the file.
+    uint64_t needed = 4 * t->size + (t->size + 3) / 4;
+    uint64_t installed = physical_memory();
+
+    if (uint64_t(size_t(needed)) != needed || (installed && needed > installed))
+    {
+        std::cerr << "Generating " << t->name << " needs " << (needed >> 20) << " MB of memory, "
+                  << (installed >> 20) << " MB are installed" << std::endl;
+        return false;
+    }
+
+    ProbeFailed = false;
+
+    for (Color c = WHITE; c <= BLACK; c++)
+    {
+        db[c].assign(t->size, UNKNOWN);
+        dirty[c].assign(t->size, 1);
+    }
+
+    run_pass(t, db, dirty, WHITE, true, threads);
+    run_pass(t, db, dirty, BLACK, true, threads);
+
+    // Stop after two passes, one for each side to move, without changes
+    for (Color c = WHITE; idlePasses < 2 && !ProbeFailed; c = ~c)
+        idlePasses = run_pass(t, db, dirty, c, false, threads) ? 0 : idlePasses + 1;
+
+    if (ProbeFailed)
+    {
+        std::cerr << "Missing or inconsistent tablebase for a capture or a promotion from "
+                  << t->name << std::endl;
+        return false;
+    }
+
+    std::ofstream file(file_name(t, path).c_str(), std::ios::out | std::ios::binary);
+    uint32_t header[] = { TBMagic, TBVersion, uint32_t(t->pieceCnt), 0 };
+
+    file.write((const char*)header, HeaderSize);
+
+    for (Color c = WHITE; c <= BLACK; c++)
+    {
+        std::vector<uint8_t> packed((t->size + 3) / 4);
+
+        for (uint64_t idx = 0; idx < t->size; idx++)
+        {
+            uint8_t r = (db[c][idx] & UNKNOWN) ? uint8_t(DRAW) : db[c][idx];
+
+            wins   += r == WIN;
+            losses += r == LOSS;
+            draws  += r == DRAW;
+            packed[idx / 4] |= r << (2 * (idx & 3));
+        }
+
+        file.write((const char*)&packed[0], packed.size());
+    }
+
+    if (!file)
+    {
+        std::cerr << "Unable to write " << file_name(t, path) << std::endl;
+        return false;
+    }
+
+    sync_cout << "info string " << t->name << ": " << wins << " wins, " << draws << " draws, "
+              << losses << " losses in " << Time::now() - elapsed << " ms" << sync_endl;
+    return true;
+  }
+}
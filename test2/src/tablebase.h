@@ -0,0 +1,48 @@
+/*
+  Stockfish, a UCI chess playing engine derived from Glaurung 2.1
+  Copyright (C) 2004-2008 Tord Romstad (Glaurung author)
+  Copyright (C) 2008-2012 Marco Costalba, Joona Kiiski, Tord Romstad
+
+  Stockfish is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  Stockfish is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+
+#if !defined(TABLEBASE_H_INCLUDED)
+#define TABLEBASE_H_INCLUDED
+
+#include <iosfwd>
+#include <string>
+
+#include "types.h"
+
+class Position;
+
+namespace Tablebases {
+
+/// Win / draw / loss tables, for the side to move, of the endgames with up to
+/// five pieces, kings included. They are generated offline by the "tbgen" UCI
+/// command, one .sftb file per material configuration, and probed in search
+/// through read-only memory mapped files, paged in by the OS on demand.
+
+enum WDLScore { WDL_LOSS = -1, WDL_DRAW = 0, WDL_WIN = 1 };
+
+extern int MaxPieces; // Largest number of pieces of the mapped tables, 0 if none
+
+void init(const std::string& path);
+bool probe_wdl(const Position& pos, WDLScore* result);
+void generate(std::istream& is);
+
+}
+
+#endif // !defined(TABLEBASE_H_INCLUDED)
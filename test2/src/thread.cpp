@@ -46,6 +46,7 @@ Thread::Thread(Fn fn) {
 
   is_searching = do_exit = false;
   maxPly = splitPointsCnt = 0;
+  busyTime = ttProbes = ttHits = 0;
   curSplitPoint = NULL;
   start_fn = fn;
   idx = Threads.size();
@@ -113,7 +114,9 @@ void Thread::main_loop() {
 
       is_searching = true;
 
+      int64_t t = Time::now_us();
       Search::think();
+      busyTime += Time::now_us() - t;
 
       assert(is_searching);
   }
@@ -229,6 +232,9 @@ void ThreadPool::read_uci_options() {
       delete threads.back();
       threads.pop_back();
   }
+
+  for (size_t i = 0; i < threads.size(); i++)
+      threads[i]->evalCache.set_size(Options["Eval Cache"]);
 }
 
 
@@ -296,6 +302,8 @@ Value ThreadPool::split(Position& pos, Stack* ss, Value alpha, Value beta,
 
   Thread* master = pos.this_thread();
 
+  STAT_INC(master, SPLIT_TRIES);
+
   if (master->splitPointsCnt >= MAX_SPLITPOINTS_PER_THREAD)
       return bestValue;
 
@@ -349,13 +357,19 @@ Value ThreadPool::split(Position& pos, Stack* ss, Value alpha, Value beta,
   mutex.unlock();
   sp.mutex.unlock();
 
+  STAT_HIST(master, SPLIT_SLAVES, slavesCnt);
+
   // Everything is set up. The master thread enters the idle loop, from which
   // it will instantly launch a search, because its is_searching flag is set.
   // The thread will return from the idle loop when all slaves have finished
   // their work at this split point.
   if (slavesCnt || Fake)
   {
+      STAT_INC(master, SPLITS);
+
+      int64_t t = Time::now_us();
       master->idle_loop();
+      master->busyTime -= Time::now_us() - t; // Minus the time spent helping below
 
       // In helpful master concept a master can help only a sub-tree of its split
       // point, and because here is all finished is not possible master is booked.
@@ -22,11 +22,13 @@
 
 #include <vector>
 
+#include "evaluate.h"
 #include "material.h"
 #include "movepick.h"
 #include "pawns.h"
 #include "position.h"
 #include "search.h"
+#include "stats.h"
 
 const int MAX_THREADS = 32;
 const int MAX_SPLITPOINTS_PER_THREAD = 8;
@@ -89,6 +91,7 @@ struct SplitPoint {
 /// and especially split points. We also use per-thread pawn and material hash
 /// tables so that once we get a pointer to an entry its life time is unlimited
 /// and we don't have to care about someone changing the entry under our feet.
+/// For the same reason also the evaluation cache is per-thread.
 
 class Thread {
 
@@ -109,8 +112,14 @@ public:
   SplitPoint splitPoints[MAX_SPLITPOINTS_PER_THREAD];
   MaterialTable materialTable;
   PawnTable pawnTable;
+  EvalCache evalCache;
+#if defined(USE_STATS)
+  Stats::Table stats;
+#endif
   size_t idx;
   int maxPly;
+  int64_t busyTime; // Microseconds spent searching, for the scaling benchmark
+  int64_t ttProbes, ttHits; // Search and qsearch TT lookups, for the bench suite
   Mutex mutex;
   ConditionVariable sleepCondition;
   NativeHandle handle;
@@ -34,6 +34,17 @@
 /// -DUSE_POPCNT  | Add runtime support for use of popcnt asm-instruction. Works
 ///               | only in 64-bit mode. For compiling requires hardware with
 ///               | popcnt support.
+///
+/// -DUSE_PEXT    | Add support for use of pext asm-instruction to index the
+///               | sliding attacks tables instead of magic multiplications.
+///               | Works only in 64-bit mode. For compiling requires hardware
+///               | with BMI2 support (-mbmi2 with gcc).
+///
+/// -DUSE_DISPATCH| Build one binary for all the 64-bit x86 CPUs. It links a
+///               | generic engine and a popcnt and a bmi2 copy of it, compiled
+///               | through arch.cpp, and main() picks one at startup after
+///               | cpuid. Excludes USE_POPCNT and USE_PEXT, requires IS_64BIT
+///               | and USE_BSFQ.
 
 #include <cctype>
 #include <climits>
@@ -47,10 +58,22 @@
 #  define USE_BSFQ
 #endif
 
+#if defined(USE_DISPATCH) && (!defined(IS_64BIT) || !defined(USE_BSFQ))
+#  error "USE_DISPATCH requires IS_64BIT and USE_BSFQ"
+#endif
+
+#if defined(USE_DISPATCH) && !defined(ARCH_SOURCE) && (defined(USE_POPCNT) || defined(USE_PEXT))
+#  error "USE_DISPATCH excludes USE_POPCNT and USE_PEXT"
+#endif
+
 #if defined(USE_POPCNT) && defined(_MSC_VER) && defined(__INTEL_COMPILER)
 #  include <nmmintrin.h> // Intel header for _mm_popcnt_u64() intrinsic
 #endif
 
+#if defined(USE_PEXT)
+#  include <immintrin.h> // Header for _pext_u64() intrinsic
+#endif
+
 #if defined(_MSC_VER) || defined(__INTEL_COMPILER)
 #  define CACHE_LINE_ALIGNMENT __declspec(align(64))
 #else
@@ -71,6 +94,12 @@ const bool HasPopCnt = true;
 const bool HasPopCnt = false;
 #endif
 
+#if defined(USE_PEXT)
+const bool HasPext = true;
+#else
+const bool HasPext = false;
+#endif
+
 #if defined(IS_64BIT)
 const bool Is64Bit = true;
 #else
@@ -80,6 +109,14 @@ const bool Is64Bit = false;
 typedef uint64_t Key;
 typedef uint64_t Bitboard;
 
+/// pext() gathers the bits of b selected by the mask m into the low bits of
+/// the result, pdep() scatters them back. They exist only in the builds that
+/// can use the instructions, every call must be under the same #if.
+#if defined(USE_PEXT)
+inline Bitboard pext(Bitboard b, Bitboard m) { return _pext_u64(b, m); }
+inline Bitboard pdep(Bitboard b, Bitboard m) { return _pdep_u64(b, m); }
+#endif
+
 const int MAX_MOVES      = 192;
 const int MAX_PLY        = 100;
 const int MAX_PLY_PLUS_2 = MAX_PLY + 2;
@@ -333,7 +370,7 @@ CACHE_LINE_ALIGNMENT
 
 extern Score pieceSquareTable[16][64]; // [piece][square]
 extern Value PieceValue[2][18];        // [Mg / Eg][piece / pieceType]
-extern int SquareDistance[64][64];     // [square][square]
+extern uint8_t SquareDistance[64][64]; // [square][square]
 
 struct MoveStack {
   Move move;
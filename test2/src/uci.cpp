@@ -25,12 +25,19 @@
 #include "notation.h"
 #include "position.h"
 #include "search.h"
+#include "tablebase.h"
 #include "thread.h"
 #include "ucioption.h"
 
 using namespace std;
 
 extern void benchmark(const Position& pos, istream& is);
+extern void eval_batch(istream& is);
+extern void material_bench(istream& is);
+extern void micro_bench(istream& is);
+extern void perft_suite(istream& is);
+extern void epd_suite(istream& is);
+extern void make_book(istream& is);
 
 namespace {
 
@@ -44,6 +51,7 @@ namespace {
   void set_option(istringstream& up);
   void set_position(Position& pos, istringstream& up);
   void go(Position& pos, istringstream& up);
+  void tables(istringstream& up);
 }
 
 
@@ -93,7 +101,15 @@ void UCI::loop(const string& args) {
           go(pos, is);
 
       else if (token == "ucinewgame")
-      { /* Avoid returning "Unknown command" */ }
+          Stats::clear();
+
+      else if (token == "stats")
+      {
+          if (is >> token && token == "clear")
+              Stats::clear();
+          else
+              Stats::print();
+      }
 
       else if (token == "isready")
           sync_cout << "readyok" << sync_endl;
@@ -116,6 +132,27 @@ void UCI::loop(const string& args) {
       else if (token == "bench")
           benchmark(pos, is);
 
+      else if (token == "evalbatch")
+          eval_batch(is);
+
+      else if (token == "materialbench")
+          material_bench(is);
+
+      else if (token == "microbench")
+          micro_bench(is);
+
+      else if (token == "epd")
+          epd_suite(is);
+
+      else if (token == "tables")
+          tables(is);
+
+      else if (token == "tbgen")
+          Tablebases::generate(is);
+
+      else if (token == "makebook")
+          make_book(is);
+
       else if (token == "key")
           sync_cout << "key: " << hex     << pos.key()
                     << "\nmaterial key: " << pos.material_key()
@@ -126,14 +163,19 @@ void UCI::loop(const string& args) {
                     << "\n"       << Options
                     << "\nuciok"  << sync_endl;
 
-      else if (token == "perft" && (is >> token)) // Read depth
+      else if (token == "perft" && (is >> token)) // Read depth or "suite"
       {
-          stringstream ss;
+          if (token == "suite")
+              perft_suite(is);
+          else
+          {
+              stringstream ss;
 
-          ss << Options["Hash"]    << " "
-             << Options["Threads"] << " " << token << " current perft";
+              ss << Options["Hash"]    << " "
+                 << Options["Threads"] << " " << token << " current perft";
 
-          benchmark(pos, ss);
+              benchmark(pos, ss);
+          }
       }
 
       else
@@ -248,4 +290,36 @@ namespace {
 
     Threads.start_searching(pos, limits, searchMoves, SetupStates);
   }
+
+
+  // tables() is called when engine receives the "tables" debug command. It
+  // generates again at runtime the tables that are precomputed in magictab.h
+  // and kpktab.h and checks they match, or prints them with the "magics" and
+  // "kpk" arguments to regenerate those files.
+
+  void tables(istringstream& is) {
+
+    string token;
+
+    Threads.wait_for_search_finished(); // Attack tables are rebuilt
+
+    if (is >> token && token == "magics")
+    {
+        Bitboards::verify_magics();
+        Bitboards::print_magics();
+    }
+    else if (token == "kpk")
+        Bitbases::print_kpk();
+
+    else
+    {
+        Time::point elapsed = Time::now();
+        bool magics = HasPext || Bitboards::verify_magics();
+        bool kpk = Bitbases::verify_kpk();
+
+        sync_cout << "Magics: " << (HasPext ? "not used" : magics ? "ok" : "mismatch")
+                  << "\nKPK bitbase: " << (kpk ? "ok" : "mismatch")
+                  << "\nGenerated in " << Time::now() - elapsed << " ms" << sync_endl;
+    }
+  }
 }
@@ -24,6 +24,7 @@
 
 #include "evaluate.h"
 #include "misc.h"
+#include "tablebase.h"
 #include "thread.h"
 #include "tt.h"
 #include "ucioption.h"
@@ -40,6 +41,7 @@ void on_eval(const Option&) { Eval::init(); }
 void on_threads(const Option&) { Threads.read_uci_options(); }
 void on_hash_size(const Option& o) { TT.set_size(o); }
 void on_clear_hash(const Option&) { TT.clear(); }
+void on_tb_path(const Option& o) { Tablebases::init(o); }
 
 
 /// Our case insensitive less() function as required by UCI protocol
@@ -64,6 +66,8 @@ void init(OptionsMap& o) {
   o["Search Log Filename"]         = Option("SearchLog.txt");
   o["Book File"]                   = Option("book.bin");
   o["Best Book Move"]              = Option(false);
+  o["Tablebase Path"]              = Option("<empty>", on_tb_path);
+#if !defined(FIXED_EVAL_WEIGHTS)
   o["Mobility (Middle Game)"]      = Option(100, 0, 200, on_eval);
   o["Mobility (Endgame)"]          = Option(100, 0, 200, on_eval);
   o["Passed Pawns (Middle Game)"]  = Option(100, 0, 200, on_eval);
@@ -71,12 +75,15 @@ void init(OptionsMap& o) {
   o["Space"]                       = Option(100, 0, 200, on_eval);
   o["Aggressiveness"]              = Option(100, 0, 200, on_eval);
   o["Cowardice"]                   = Option(100, 0, 200, on_eval);
+#endif
+  o["Lazy Eval Margin"]            = Option(0, 0, 2000, on_eval);
   o["Min Split Depth"]             = Option(msd, 4, 7, on_threads);
   o["Max Threads per Split Point"] = Option(5, 4, 8, on_threads);
   o["Threads"]                     = Option(cpus, 1, MAX_THREADS, on_threads);
   o["Use Sleeping Threads"]        = Option(false, on_threads);
   o["Hash"]                        = Option(32, 4, 8192, on_hash_size);
   o["Clear Hash"]                  = Option(on_clear_hash);
+  o["Eval Cache"]                  = Option(1, 0, 256, on_threads);
   o["Ponder"]                      = Option(true);
   o["OwnBook"]                     = Option(false);
   o["MultiPV"]                     = Option(1, 1, 500);
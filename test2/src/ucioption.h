@@ -22,6 +22,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 namespace UCI {
 
@@ -61,6 +62,7 @@ private:
 
 void init(OptionsMap&);
 void loop(const std::string&);
+void batch_loop(const std::vector<std::string>&);
 
 } // namespace UCI
 